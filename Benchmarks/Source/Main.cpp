@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "SessionBenchmark.h"
+#include "StageBenchmarks.h"
+#include "TailBenchmark.h"
+
+namespace
+{
+    MeasureOptions getMeasureOptions (const juce::ArgumentList& args, std::unique_ptr<PerfCounters>& counters)
+    {
+        MeasureOptions options;
+
+        if (args.containsOption ("--seconds"))
+            options.seconds = juce::jmax (0.01, args.getValueForOption ("--seconds").getDoubleValue());
+
+        if (args.containsOption ("--counters"))
+        {
+            counters = std::make_unique<PerfCounters>();
+
+            if (counters->isOpen())
+                options.counters = counters.get();
+            else
+                std::cerr << "Hardware counters aren't available here, timing only" << std::endl;
+        }
+
+        return options;
+    }
+}
+
+// Benchmarks <command> [options]
+//
+// Every command prints a JSON report to stdout, or writes it to --output=<file>, for tracking from
+// build to build. Progress goes to stderr. Build the Release configuration for meaningful numbers.
+int main (int argc, char* argv[])
+{
+    // The processor needs a message manager, even without an editor.
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::ConsoleApplication app;
+    app.addHelpCommand ("--help|-h", "Usage:", true);
+
+    app.addCommand ({ "stages",
+                      "stages [--counters] [--seconds=<per stage>] [--output=<file>]",
+                      "Times each DSP stage on its own",
+                      "With --counters, cycles, instructions, cache misses and branch misses are counted as well (Linux only).",
+                      [] (const juce::ArgumentList& args)
+                      {
+                          std::unique_ptr<PerfCounters> counters;
+                          const auto options = getMeasureOptions (args, counters);
+
+                          if (! writeReport (makeReport ("stages", runStageBenchmarks (options)), args))
+                              juce::ConsoleApplication::fail ("", 1);
+                      } });
+
+    app.addCommand ({ "tail",
+                      "tail [--max-slowdown=<ratio>] [--output=<file>]",
+                      "Renders decaying tails with subnormals allowed, and checks they don't slow down",
+                      "Fails if a block takes more than --max-slowdown times (1.5 by default) as long late in the tail as right "
+                      "after the impulse, if the tank ever holds a subnormal, or if it doesn't go to sleep where it may.",
+                      [] (const juce::ArgumentList& args)
+                      {
+                          auto maxSlowdown = 1.5;
+
+                          if (args.containsOption ("--max-slowdown"))
+                              maxSlowdown = juce::jmax (1.0, args.getValueForOption ("--max-slowdown").getDoubleValue());
+
+                          juce::Array<juce::var> results;
+                          const auto passed = runTailBenchmark (maxSlowdown, results);
+
+                          if (! writeReport (makeReport ("tail", results), args))
+                              juce::ConsoleApplication::fail ("", 1);
+
+                          if (! passed)
+                              juce::ConsoleApplication::fail ("The tail slowed down, held subnormals or never slept", 1);
+                      } });
+
+    app.addCommand ({ "session",
+                      "session [--max-instances=<n>] [--max-threads=<n>] [--seconds=<audio per run>] [--output=<file>]",
+                      "Processes many plugin instances across host threads",
+                      "The instance count doubles up to --max-instances (64 by default), and each count runs on 1, 2, 4... "
+                      "threads up to --max-threads (one per logical core by default). Reports how many times realtime each "
+                      "run keeps up, its scaling over one thread, and the resident memory per instance.",
+                      [] (const juce::ArgumentList& args)
+                      {
+                          SessionOptions options;
+
+                          if (args.containsOption ("--max-instances"))
+                              options.maxInstances = juce::jmax (1, args.getValueForOption ("--max-instances").getIntValue());
+
+                          if (args.containsOption ("--max-threads"))
+                              options.maxThreads = juce::jmax (1, args.getValueForOption ("--max-threads").getIntValue());
+
+                          if (args.containsOption ("--seconds"))
+                              options.seconds = juce::jmax (0.1, args.getValueForOption ("--seconds").getDoubleValue());
+
+                          if (! writeReport (makeReport ("session", runSessionBenchmark (options)), args))
+                              juce::ConsoleApplication::fail ("", 1);
+                      } });
+
+    return app.findAndRunCommand (argc, argv);
+}
@@ -0,0 +1,86 @@
+/*
+  ==============================================================================
+
+    Measure.cpp
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Measure.h"
+
+juce::var Measurement::toVar() const
+{
+    auto* object = new juce::DynamicObject();
+    object->setProperty ("name", name);
+    object->setProperty ("calls", calls);
+    object->setProperty ("nsPerCall", medianNanoseconds);
+    object->setProperty ("nsPerCallFastest", fastestNanoseconds);
+
+    if (samplesPerCall > 0)
+    {
+        object->setProperty ("samplesPerCall", samplesPerCall);
+        object->setProperty ("nsPerSample", medianNanoseconds / samplesPerCall);
+    }
+
+    if (hasCounters && calls > 0)
+    {
+        const auto perCall = [this] (juce::int64 total) { return static_cast<double> (total) / static_cast<double> (calls); };
+
+        auto* perCallCounters = new juce::DynamicObject();
+        perCallCounters->setProperty ("cycles", perCall (counters.cycles));
+        perCallCounters->setProperty ("instructions", perCall (counters.instructions));
+        perCallCounters->setProperty ("cacheMisses", perCall (counters.cacheMisses));
+        perCallCounters->setProperty ("branchMisses", perCall (counters.branchMisses));
+
+        if (counters.cycles > 0)
+            perCallCounters->setProperty ("instructionsPerCycle", static_cast<double> (counters.instructions) / static_cast<double> (counters.cycles));
+
+        object->setProperty ("counters", juce::var (perCallCounters));
+    }
+
+    return juce::var (object);
+}
+
+juce::var makeReport (const juce::String& benchmark, const juce::Array<juce::var>& results)
+{
+    auto* report = new juce::DynamicObject();
+    report->setProperty ("benchmark", benchmark);
+    report->setProperty ("time", juce::Time::getCurrentTime().toISO8601 (true));
+    report->setProperty ("cpu", juce::SystemStats::getCpuModel());
+    report->setProperty ("logicalCores", juce::SystemStats::getNumCpus());
+    report->setProperty ("physicalCores", juce::SystemStats::getNumPhysicalCpus());
+    report->setProperty ("os", juce::SystemStats::getOperatingSystemName());
+    report->setProperty ("juce", juce::SystemStats::getJUCEVersion());
+
+   #if JUCE_DEBUG
+    report->setProperty ("build", "Debug");
+   #else
+    report->setProperty ("build", "Release");
+   #endif
+
+    report->setProperty ("results", juce::var (results));
+    return juce::var (report);
+}
+
+bool writeReport (const juce::var& report, const juce::ArgumentList& args)
+{
+    const auto json = juce::JSON::toString (report);
+
+    if (! args.containsOption ("--output"))
+    {
+        std::cout << json << std::endl;
+        return true;
+    }
+
+    const auto file = juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--output"));
+
+    if (! file.replaceWithText (json + "\n"))
+    {
+        std::cerr << "Couldn't write " << file.getFullPathName() << std::endl;
+        return false;
+    }
+
+    return true;
+}
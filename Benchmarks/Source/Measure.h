@@ -0,0 +1,107 @@
+/*
+  ==============================================================================
+
+    Measure.h
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "PerfCounters.h"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+struct MeasureOptions
+{
+    double seconds { 0.5 };                 // roughly how long each stage is timed for
+    PerfCounters* counters { nullptr };     // counted as well when set and open
+};
+
+struct Measurement
+{
+    juce::String name;
+    int samplesPerCall { 0 };               // 0 for stages that don't render audio
+    juce::int64 calls { 0 };
+
+    // Per call. Each run times a batch of calls, and the median over the runs is what gets
+    // reported, so an interrupt or a page fault in one run doesn't move it.
+    double medianNanoseconds { 0.0 };
+    double fastestNanoseconds { 0.0 };
+
+    bool hasCounters { false };
+    Counters counters;                      // totals over every call
+
+    juce::var toVar() const;
+};
+
+// Calls `call` over and over for about `options.seconds` and reports how long one call takes.
+// The runs are made long enough for the clock to resolve them, and the first ones double as a
+// warm-up, so caches, branch predictors and lazily allocated memory have settled before any run
+// is kept.
+template <typename Callable>
+Measurement measure (const juce::String& name, int samplesPerCall, const MeasureOptions& options, Callable&& call)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr auto minRunLength = std::chrono::milliseconds (2);
+    constexpr int minRuns { 7 };
+
+    int callsPerRun = 1;
+
+    for (;;)
+    {
+        const auto start = Clock::now();
+
+        for (int i = 0; i < callsPerRun; ++i)
+            call();
+
+        if (Clock::now() - start >= minRunLength || callsPerRun >= (1 << 24))
+            break;
+
+        callsPerRun *= 2;
+    }
+
+    auto* counters = options.counters != nullptr && options.counters->isOpen() ? options.counters : nullptr;
+
+    Measurement measurement;
+    measurement.name = name;
+    measurement.samplesPerCall = samplesPerCall;
+    measurement.hasCounters = counters != nullptr;
+
+    std::vector<double> runs;
+    const auto deadline = Clock::now() + std::chrono::duration<double> (options.seconds);
+
+    while (static_cast<int> (runs.size()) < minRuns || Clock::now() < deadline)
+    {
+        if (counters != nullptr)
+            counters->start();
+
+        const auto start = Clock::now();
+
+        for (int i = 0; i < callsPerRun; ++i)
+            call();
+
+        const auto elapsed = std::chrono::duration<double, std::nano> (Clock::now() - start).count();
+
+        if (counters != nullptr)
+            measurement.counters += counters->stop();
+
+        runs.push_back (elapsed / callsPerRun);
+        measurement.calls += callsPerRun;
+    }
+
+    std::sort (runs.begin(), runs.end());
+    measurement.medianNanoseconds = runs[runs.size() / 2];
+    measurement.fastestNanoseconds = runs.front();
+
+    return measurement;
+}
+
+// Wraps results in what every report carries: which benchmark, when, on what machine and build.
+juce::var makeReport (const juce::String& benchmark, const juce::Array<juce::var>& results);
+
+// Writes the report as JSON to the file given with --output=<file>, or to stdout.
+bool writeReport (const juce::var& report, const juce::ArgumentList& args);
@@ -0,0 +1,114 @@
+/*
+  ==============================================================================
+
+    PerfCounters.cpp
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "PerfCounters.h"
+
+#if JUCE_LINUX
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
+Counters& Counters::operator+= (const Counters& other) noexcept
+{
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cacheMisses += other.cacheMisses;
+    branchMisses += other.branchMisses;
+    return *this;
+}
+
+PerfCounters::PerfCounters()
+{
+   #if JUCE_LINUX
+    const juce::uint64 events[numEvents] { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                           PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES };
+
+    // One group, so all four are scheduled onto the PMU together and read in a single call.
+    for (int i = 0; i < numEvents; ++i)
+    {
+        perf_event_attr attributes {};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof (attributes);
+        attributes.config = events[i];
+        attributes.disabled = i == 0 ? 1 : 0;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_GROUP;
+
+        descriptors[i] = static_cast<int> (syscall (SYS_perf_event_open, &attributes, 0, -1, i == 0 ? -1 : descriptors[0], 0));
+
+        if (descriptors[i] < 0)
+        {
+            close();
+            return;
+        }
+    }
+
+    leader = descriptors[0];
+   #endif
+}
+
+PerfCounters::~PerfCounters()
+{
+    close();
+}
+
+void PerfCounters::close() noexcept
+{
+   #if JUCE_LINUX
+    for (auto& descriptor : descriptors)
+    {
+        if (descriptor >= 0)
+            ::close (descriptor);
+
+        descriptor = -1;
+    }
+   #endif
+
+    leader = -1;
+}
+
+void PerfCounters::start() noexcept
+{
+   #if JUCE_LINUX
+    if (! isOpen())
+        return;
+
+    ioctl (leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl (leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+   #endif
+}
+
+Counters PerfCounters::stop() noexcept
+{
+    Counters counters;
+
+   #if JUCE_LINUX
+    if (! isOpen())
+        return counters;
+
+    ioctl (leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP: the number of events, then one value per event in the order they were opened.
+    juce::uint64 values[1 + numEvents] {};
+
+    if (read (leader, values, sizeof (values)) == static_cast<ssize_t> (sizeof (values)) && values[0] == numEvents)
+    {
+        counters.cycles = static_cast<juce::int64> (values[1]);
+        counters.instructions = static_cast<juce::int64> (values[2]);
+        counters.cacheMisses = static_cast<juce::int64> (values[3]);
+        counters.branchMisses = static_cast<juce::int64> (values[4]);
+    }
+   #endif
+
+    return counters;
+}
@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    PerfCounters.h
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Hardware event counts over some stretch of code.
+struct Counters
+{
+    juce::int64 cycles { 0 };
+    juce::int64 instructions { 0 };
+    juce::int64 cacheMisses { 0 };
+    juce::int64 branchMisses { 0 };
+
+    Counters& operator+= (const Counters& other) noexcept;
+};
+
+// Cycles, instructions, cache misses and branch misses of the calling thread, read through
+// perf_event_open(). Only Linux has it, and even there the kernel may refuse (see
+// /proc/sys/kernel/perf_event_paranoid), in which case isOpen() is false and stop() returns zeros.
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    bool isOpen() const noexcept { return leader >= 0; }
+
+    void start() noexcept;
+    Counters stop() noexcept;
+
+private:
+    void close() noexcept;
+
+    static constexpr int numEvents { 4 };
+
+    int leader { -1 };
+    int descriptors[numEvents] { -1, -1, -1, -1 };
+
+    JUCE_DECLARE_NON_COPYABLE (PerfCounters)
+};
@@ -0,0 +1,403 @@
+/*
+  ==============================================================================
+
+    SessionBenchmark.cpp
+    Created: 20 Oct 2026 2:48:31am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "SessionBenchmark.h"
+#include "../../Source/PluginProcessor.h"
+#include <thread>
+
+#if JUCE_LINUX
+ #include <fstream>
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+namespace
+{
+    constexpr double sampleRate { 48000.0 };
+    constexpr int blockSize { 512 };
+    constexpr double blockSeconds { blockSize / sampleRate };
+
+    // Rendered before each timed run, so a new thread count starts from settled caches.
+    constexpr int warmUpBlocks { 32 };
+
+    //==============================================================================
+    // Host audio threads. run() hands the jobs of one block out across them, takes part itself
+    // and returns once every job is done. Between blocks the helpers spin, as many hosts' audio
+    // threads do while they wait for the next callback, so handing over costs no wake-ups.
+    class HostThreads
+    {
+    public:
+        explicit HostThreads (int numThreads)
+        {
+            for (int i = 1; i < numThreads; ++i)
+            {
+                helpers.add (new Helper (*this));
+                helpers.getLast()->startThread();
+            }
+        }
+
+        ~HostThreads()
+        {
+            shouldExit = true;
+            generation.fetch_add (1, std::memory_order_release);
+
+            for (auto* helper : helpers)
+                helper->stopThread (-1);
+        }
+
+        // Calls callable (index) for every index in [0, numJobs).
+        template <typename Callable>
+        void run (int numJobs, Callable& callable)
+        {
+            job = [] (void* c, int index) { (*static_cast<Callable*> (c)) (index); };
+            context = &callable;
+            total = numJobs;
+            next.store (0, std::memory_order_relaxed);
+            busyHelpers.store (helpers.size(), std::memory_order_relaxed);
+            generation.fetch_add (1, std::memory_order_release);
+
+            work();
+
+            while (busyHelpers.load (std::memory_order_acquire) > 0)
+                std::this_thread::yield();
+        }
+
+    private:
+        class Helper : public juce::Thread
+        {
+        public:
+            explicit Helper (HostThreads& t) : juce::Thread ("Session host thread"), threads (t) {}
+            void run() override { threads.helperLoop(); }
+
+        private:
+            HostThreads& threads;
+        };
+
+        void helperLoop()
+        {
+            // run() waits for every helper before it starts the next block, so each one sees
+            // every generation and can count them rather than read them.
+            juce::uint32 seen = 0;
+
+            for (;;)
+            {
+                while (generation.load (std::memory_order_acquire) == seen)
+                    std::this_thread::yield();
+
+                ++seen;
+
+                if (shouldExit)
+                    return;
+
+                work();
+                busyHelpers.fetch_sub (1, std::memory_order_release);
+            }
+        }
+
+        void work()
+        {
+            for (auto i = next.fetch_add (1, std::memory_order_relaxed); i < total; i = next.fetch_add (1, std::memory_order_relaxed))
+                job (context, i);
+        }
+
+        // Written by run() before it moves the generation on, read by the helpers after.
+        void (*job) (void*, int) { nullptr };
+        void* context { nullptr };
+        int total { 0 };
+
+        std::atomic<int> next { 0 };
+        std::atomic<int> busyHelpers { 0 };
+        std::atomic<juce::uint32> generation { 0 };
+        std::atomic<bool> shouldExit { false };
+
+        juce::OwnedArray<Helper> helpers;
+
+        JUCE_DECLARE_NON_COPYABLE (HostThreads)
+    };
+
+    //==============================================================================
+    enum class Input
+    {
+        steady,
+        bursts,             // half a second of noise in every two, so the tail sleeps and wakes
+        silent,             // the tail sleeps from the start
+        bypassed            // steady, and bypassed for two seconds in every four
+    };
+
+    struct Instance
+    {
+        std::unique_ptr<SimpleRoomReverbAudioProcessor> processor;
+        juce::RangedAudioParameter* bypass { nullptr };
+        bool isBypassed { false };
+        Input input { Input::steady };
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+    };
+
+    std::unique_ptr<Instance> makeInstance (int index)
+    {
+        auto instance = std::make_unique<Instance>();
+        instance->processor = std::make_unique<SimpleRoomReverbAudioProcessor>();
+        instance->input = static_cast<Input> (index % 4);
+
+        auto& processor = *instance->processor;
+        instance->bypass = processor.getPluginState().getParameter (Parameters::bypass);
+
+        // Every parameter but the bypass, which the input pattern sees to. That takes in the core
+        // mode, freeze, the gate and the ducker, so instances differ in cost as they would in a
+        // real session. The core mode is set before prepareToPlay(), which prepares for it.
+        juce::Random random (0x5e55 + index);
+
+        for (auto* parameter : processor.getParameters())
+            if (auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*> (parameter))
+                if (withID->getParameterID() != Parameters::bypass)
+                    withID->setValueNotifyingHost (random.nextFloat());
+
+        processor.setRateAndBufferSizeDetails (sampleRate, blockSize);
+        processor.prepareToPlay (sampleRate, blockSize);
+
+        const auto numChannels = juce::jmax (processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+        instance->buffer.setSize (numChannels, blockSize);
+
+        return instance;
+    }
+
+    juce::AudioBuffer<float> makeNoise()
+    {
+        juce::AudioBuffer<float> noise (2, blockSize);
+        juce::Random random (0x5eed);
+
+        for (int channel = 0; channel < noise.getNumChannels(); ++channel)
+            for (int i = 0; i < blockSize; ++i)
+                noise.setSample (channel, i, 0.25f * (random.nextFloat() * 2.0f - 1.0f));
+
+        return noise;
+    }
+
+    double getPatternSeconds (juce::int64 blockIndex) noexcept
+    {
+        return std::fmod (static_cast<double> (blockIndex) * blockSeconds, 4.0);
+    }
+
+    // Message thread, between blocks, as automation from the host would be.
+    void updateBypass (Instance& instance, juce::int64 blockIndex)
+    {
+        const auto shouldBypass = instance.input == Input::bypassed && getPatternSeconds (blockIndex) >= 2.0;
+
+        if (shouldBypass != instance.isBypassed)
+        {
+            instance.bypass->setValueNotifyingHost (shouldBypass ? 1.0f : 0.0f);
+            instance.isBypassed = shouldBypass;
+        }
+    }
+
+    // Host thread.
+    void processBlock (Instance& instance, const juce::AudioBuffer<float>& noise, juce::int64 blockIndex)
+    {
+        const auto hasInput = instance.input != Input::silent
+                           && (instance.input != Input::bursts || std::fmod (getPatternSeconds (blockIndex), 2.0) < 0.5);
+
+        auto& buffer = instance.buffer;
+
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            if (hasInput && channel < noise.getNumChannels())
+                buffer.copyFrom (channel, 0, noise, channel, 0, blockSize);
+            else
+                buffer.clear (channel, 0, blockSize);
+        }
+
+        // The same as the plugin wrappers do around every callback.
+        auto& processor = *instance.processor;
+        const juce::ScopedLock sl (processor.getCallbackLock());
+
+        if (processor.isSuspended())
+            buffer.clear();
+        else
+            processor.processBlock (buffer, instance.midi);
+    }
+
+    //==============================================================================
+    struct Run
+    {
+        int threads { 0 };
+        double realtime { 0.0 };            // instances times audio seconds, per second
+        double medianLoad { 0.0 };          // time for a block of every instance, over the block's length
+        double worstLoad { 0.0 };
+    };
+
+    Run runSession (std::vector<std::unique_ptr<Instance>>& instances, const juce::AudioBuffer<float>& noise,
+                    int numThreads, int numBlocks, juce::int64& blockIndex)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        HostThreads threads (numThreads);
+        const auto numInstances = static_cast<int> (instances.size());
+
+        auto process = [&] (int index)
+        {
+            processBlock (*instances[static_cast<size_t> (index)], noise, blockIndex);
+        };
+
+        const auto renderBlock = [&]
+        {
+            for (auto& instance : instances)
+                updateBypass (*instance, blockIndex);
+
+            threads.run (numInstances, process);
+            ++blockIndex;
+        };
+
+        for (int i = 0; i < warmUpBlocks; ++i)
+            renderBlock();
+
+        std::vector<double> blockTimes;
+        blockTimes.reserve (static_cast<size_t> (numBlocks));
+        const auto start = Clock::now();
+
+        for (int i = 0; i < numBlocks; ++i)
+        {
+            const auto blockStart = Clock::now();
+            renderBlock();
+            blockTimes.push_back (std::chrono::duration<double> (Clock::now() - blockStart).count());
+        }
+
+        const auto elapsed = std::chrono::duration<double> (Clock::now() - start).count();
+        std::sort (blockTimes.begin(), blockTimes.end());
+
+        Run run;
+        run.threads = numThreads;
+        run.realtime = numInstances * numBlocks * blockSeconds / elapsed;
+        run.medianLoad = blockTimes[blockTimes.size() / 2] / blockSeconds;
+        run.worstLoad = blockTimes.back() / blockSeconds;
+        return run;
+    }
+
+    //==============================================================================
+    // Of the whole process, or -1 where it can't be read.
+    juce::int64 getResidentBytes()
+    {
+       #if JUCE_LINUX
+        // Read with a plain stream, as /proc files report a length of zero.
+        std::ifstream statm ("/proc/self/statm");
+        juce::int64 totalPages = 0, residentPages = 0;
+
+        if (statm >> totalPages >> residentPages)
+            return residentPages * static_cast<juce::int64> (sysconf (_SC_PAGESIZE));
+       #elif JUCE_MAC
+        mach_task_basic_info info {};
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+
+        if (task_info (mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t> (&info), &count) == KERN_SUCCESS)
+            return static_cast<juce::int64> (info.resident_size);
+       #endif
+
+        return -1;
+    }
+
+    juce::String toMegabytes (double bytes)
+    {
+        return juce::String (bytes / (1024.0 * 1024.0), 2) + " MB";
+    }
+}
+
+juce::Array<juce::var> runSessionBenchmark (const SessionOptions& options)
+{
+    const auto maxInstances = juce::jmax (1, options.maxInstances);
+    const auto maxThreads = options.maxThreads > 0 ? options.maxThreads : juce::SystemStats::getNumCpus();
+    const auto numBlocks = juce::jmax (1, juce::roundToInt (options.seconds / blockSeconds));
+    const auto noise = makeNoise();
+
+    std::vector<std::unique_ptr<Instance>> instances;
+    juce::int64 blockIndex = 0;
+
+    const auto baseline = getResidentBytes();
+    auto lastResident = baseline;
+
+    juce::Array<juce::var> results;
+
+    for (int numInstances = 1;; numInstances = juce::jmin (numInstances * 2, maxInstances))
+    {
+        const auto numAdded = numInstances - static_cast<int> (instances.size());
+
+        while (static_cast<int> (instances.size()) < numInstances)
+        {
+            instances.push_back (makeInstance (static_cast<int> (instances.size())));
+
+            // One block first, so whatever the instance allocates or touches lazily is resident.
+            processBlock (*instances.back(), noise, blockIndex);
+        }
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("instances", numInstances);
+
+        if (baseline >= 0)
+        {
+            const auto resident = getResidentBytes();
+
+            // The first instance pays for what every instance shares as well, the added ones
+            // show what one more costs.
+            const auto perInstance = static_cast<double> (resident - baseline) / numInstances;
+            const auto perAddedInstance = static_cast<double> (resident - lastResident) / numAdded;
+            lastResident = resident;
+
+            std::cerr << numInstances << " instances: " << toMegabytes (perInstance) << " resident each, "
+                      << toMegabytes (perAddedInstance) << " for each one added" << std::endl;
+
+            result->setProperty ("residentBytes", resident);
+            result->setProperty ("residentBytesPerInstance", perInstance);
+            result->setProperty ("residentBytesPerAddedInstance", perAddedInstance);
+        }
+        else
+        {
+            result->setProperty ("residentBytes", juce::var());
+        }
+
+        // More threads than instances would only leave some waiting.
+        const auto threadLimit = juce::jmin (maxThreads, numInstances);
+        juce::Array<juce::var> runs;
+        double singleThreaded = 0.0;
+
+        for (int numThreads = 1;; numThreads = juce::jmin (numThreads * 2, threadLimit))
+        {
+            const auto run = runSession (instances, noise, numThreads, numBlocks, blockIndex);
+
+            if (numThreads == 1)
+                singleThreaded = run.realtime;
+
+            const auto speedup = run.realtime / singleThreaded;
+
+            std::cerr << "    " << numThreads << " threads: " << juce::String (run.realtime, 1) << "x realtime, "
+                      << juce::String (speedup, 2) << "x one thread, slowest block took "
+                      << juce::String (run.worstLoad * 100.0, 1) << "% of its length" << std::endl;
+
+            auto* object = new juce::DynamicObject();
+            object->setProperty ("threads", numThreads);
+            object->setProperty ("realtime", run.realtime);
+            object->setProperty ("speedup", speedup);
+            object->setProperty ("efficiency", speedup / numThreads);
+            object->setProperty ("medianBlockLoad", run.medianLoad);
+            object->setProperty ("worstBlockLoad", run.worstLoad);
+            runs.add (juce::var (object));
+
+            if (numThreads >= threadLimit)
+                break;
+        }
+
+        result->setProperty ("runs", juce::var (runs));
+        results.add (juce::var (result));
+
+        if (numInstances >= maxInstances)
+            break;
+    }
+
+    return results;
+}
@@ -0,0 +1,30 @@
+/*
+  ==============================================================================
+
+    SessionBenchmark.h
+    Created: 20 Oct 2026 2:48:31am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "Measure.h"
+
+struct SessionOptions
+{
+    int maxInstances { 64 };
+    int maxThreads { 0 };                   // 0 for one per logical core
+    double seconds { 2.0 };                 // of audio per run
+};
+
+// Loads whole plugin instances the way a busy session does and processes them from a group of
+// host threads, a block at a time. Each instance gets its own random parameters and one of four
+// inputs: steady noise, bursts with silence between them, silence throughout, and steady noise
+// with the plugin bypassed half the time.
+//
+// The instance count doubles up to `maxInstances`. At each count the resident memory is read,
+// then the same session runs on 1, 2, 4... threads up to `maxThreads`, reporting how many times
+// realtime it runs, its speedup over one thread and its slowest block. Message thread.
+juce::Array<juce::var> runSessionBenchmark (const SessionOptions& options);
@@ -0,0 +1,247 @@
+/*
+  ==============================================================================
+
+    StageBenchmarks.cpp
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "StageBenchmarks.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    constexpr double sampleRate { 48000.0 };
+    constexpr int blockSize { 512 };
+    constexpr int numChannels { 2 };
+
+    // Results are written here so the optimiser can't drop a call whose result is never used.
+    volatile float sink { 0.0f };
+
+    juce::AudioBuffer<float> makeNoise()
+    {
+        juce::AudioBuffer<float> noise (numChannels, blockSize);
+        juce::Random random (0x5eed);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < blockSize; ++i)
+                noise.setSample (channel, i, 0.25f * (random.nextFloat() * 2.0f - 1.0f));
+
+        return noise;
+    }
+
+    void copy (juce::AudioBuffer<float>& dest, const juce::AudioBuffer<float>& source) noexcept
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            juce::FloatVectorOperations::copy (dest.getWritePointer (channel), source.getReadPointer (channel), blockSize);
+    }
+
+    void add (juce::Array<juce::var>& results, const Measurement& measurement)
+    {
+        std::cerr << measurement.name << ": " << juce::String (measurement.medianNanoseconds, 1) << " ns per call" << std::endl;
+        results.add (measurement.toVar());
+    }
+
+    // The same as the engine does: sample by sample, snapping the state once per micro-block.
+    void runFilter (juce::dsp::StateVariableTPTFilter<float>& filter, juce::AudioBuffer<float>& buffer) noexcept
+    {
+        for (int start = 0; start < blockSize; start += MicroBlock::size)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                auto* samples = buffer.getWritePointer (channel, start);
+
+                for (int i = 0; i < MicroBlock::size; ++i)
+                    samples[i] = filter.processSample (channel, samples[i]);
+            }
+
+            filter.snapToZero();
+        }
+    }
+}
+
+juce::Array<juce::var> runStageBenchmarks (const MeasureOptions& options)
+{
+    const juce::dsp::ProcessSpec spec { sampleRate, static_cast<juce::uint32> (blockSize), static_cast<juce::uint32> (numChannels) };
+    const auto noise = makeNoise();
+    juce::AudioBuffer<float> work (numChannels, blockSize);
+
+    SimpleRoomReverbAudioProcessor processor;
+    auto& state = processor.getPluginState();
+    const auto settings = getSettings (state);
+
+    juce::Array<juce::var> results;
+
+    //==============================================================================
+    add (results, measure ("getSettings", 0, options, [&]
+    {
+        sink = getSettings (state).size;
+    }));
+
+    {
+        // Every parameter moves, so the filters, the tank and the ducker are all recomputed.
+        auto moved = settings;
+        moved.size += 0.1f;
+        moved.damp += 0.1f;
+        moved.lowPassFreq *= 0.5f;
+        moved.highPassFreq *= 2.0f;
+        moved.duckDepth += 6.0f;
+
+        Engine<float> engine;
+        engine.setSettings (settings, true);
+        engine.prepare (spec);
+
+        auto flip = false;
+
+        add (results, measure ("Engine::setSettings (forced)", 0, options, [&]
+        {
+            flip = ! flip;
+            engine.setSettings (flip ? moved : settings, true);
+        }));
+
+        // Only the tank moves, as with most automation.
+        auto resized = settings;
+        resized.size += 0.1f;
+
+        add (results, measure ("Engine::setSettings (size only)", 0, options, [&]
+        {
+            flip = ! flip;
+            engine.setSettings (flip ? resized : settings);
+        }));
+    }
+
+    //==============================================================================
+    {
+        Reverb<float> reverb;
+        reverb.prepare (spec);
+        reverb.reset();
+
+        juce::dsp::AudioBlock<float> block (work);
+
+        const auto captureBatch = [&]
+        {
+            reverb.beginBatch (numChannels);
+
+            for (int start = 0; start < blockSize; start += MicroBlock::size)
+                reverb.beginSlice (block.getSubBlock (static_cast<size_t> (start), MicroBlock::size), start);
+        };
+
+        copy (work, noise);
+        captureBatch();
+
+        // The same captured batch over and over, which keeps the tanks busy with input.
+        add (results, measure ("Reverb::processTank (both channels)", blockSize, options, [&]
+        {
+            reverb.processTank (0);
+            reverb.processTank (1);
+        }));
+
+        add (results, measure ("Reverb (all three passes)", blockSize, options, [&]
+        {
+            copy (work, noise);
+            captureBatch();
+            reverb.processTank (0);
+            reverb.processTank (1);
+
+            for (int i = 0; i < blockSize / MicroBlock::size; ++i)
+                reverb.endSlice (block.getSubBlock (static_cast<size_t> (i * MicroBlock::size), MicroBlock::size), i);
+        }));
+    }
+
+    //==============================================================================
+    {
+        juce::dsp::StateVariableTPTFilter<float> lowPassFilter, highPassFilter;
+        lowPassFilter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);
+        highPassFilter.setType (juce::dsp::StateVariableTPTFilterType::highpass);
+        lowPassFilter.prepare (spec);
+        highPassFilter.prepare (spec);
+        lowPassFilter.setCutoffFrequency (8000.0f);
+        highPassFilter.setCutoffFrequency (80.0f);
+
+        add (results, measure ("StateVariableTPTFilter (lowpass)", blockSize, options, [&]
+        {
+            copy (work, noise);
+            runFilter (lowPassFilter, work);
+        }));
+
+        add (results, measure ("StateVariableTPTFilter (highpass)", blockSize, options, [&]
+        {
+            copy (work, noise);
+            runFilter (highPassFilter, work);
+        }));
+
+        // What the engine's filter update costs when either cutoff is automated.
+        auto flip = false;
+
+        add (results, measure ("StateVariableTPTFilter::setCutoffFrequency (both filters)", 0, options, [&]
+        {
+            flip = ! flip;
+            lowPassFilter.setCutoffFrequency (flip ? 9000.0f : 8000.0f);
+            highPassFilter.setCutoffFrequency (flip ? 90.0f : 80.0f);
+        }));
+    }
+
+    //==============================================================================
+    {
+        FreezeEngine<float> freezeEngine;
+        freezeEngine.prepare (sampleRate);
+
+        float tankGains[MicroBlock::size], loopGains[MicroBlock::size];
+
+        const auto runFreeze = [&]
+        {
+            copy (work, noise);
+
+            for (int start = 0; start < blockSize; start += MicroBlock::size)
+            {
+                const auto slice = freezeEngine.advance (tankGains, loopGains, MicroBlock::size);
+                freezeEngine.process (slice, work.getWritePointer (0, start), work.getWritePointer (1, start),
+                                      tankGains, loopGains, MicroBlock::size);
+            }
+        };
+
+        // Not frozen, the tank output is only recorded for a loop to come.
+        add (results, measure ("FreezeEngine::process (recording)", blockSize, options, runFreeze));
+
+        // The warm-up captures the loop and finishes the crossfade, so the loop is what gets timed.
+        freezeEngine.setLooping (true, false);
+        add (results, measure ("FreezeEngine::process (looping)", blockSize, options, runFreeze));
+    }
+
+    //==============================================================================
+    {
+        Engine<float> engine;
+        engine.setSettings (settings, true);
+        engine.prepare (spec);
+        engine.reset();
+
+        juce::dsp::AudioBlock<float> block (work);
+        const juce::dsp::AudioBlock<const float> key (block);
+
+        add (results, measure ("Engine::process", blockSize, options, [&]
+        {
+            copy (work, noise);
+            engine.process (block, key, [&settings] (int) { return settings; }, nullptr, nullptr);
+        }));
+    }
+
+    //==============================================================================
+    {
+        juce::MemoryBlock saved;
+
+        add (results, measure ("getStateInformation", 0, options, [&]
+        {
+            saved.reset();
+            processor.getStateInformation (saved);
+        }));
+
+        add (results, measure ("setStateInformation", 0, options, [&]
+        {
+            processor.setStateInformation (saved.getData(), static_cast<int> (saved.getSize()));
+        }));
+    }
+
+    return results;
+}
@@ -0,0 +1,18 @@
+/*
+  ==============================================================================
+
+    StageBenchmarks.h
+    Created: 20 Oct 2026 1:27:43am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "Measure.h"
+
+// Times each stage of the chain on its own, in float at 48 kHz with blocks of 512 samples: the
+// parameter snapshot, coefficient updates, the tanks, the output filters, the looping freeze, the
+// whole engine for comparison, and saving and loading the plugin state. Message thread.
+juce::Array<juce::var> runStageBenchmarks (const MeasureOptions& options);
@@ -0,0 +1,210 @@
+/*
+  ==============================================================================
+
+    TailBenchmark.cpp
+    Created: 20 Oct 2026 2:06:15am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "TailBenchmark.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    constexpr int blockSize { 512 };
+
+    // Block times are summarised by their median over each stretch of this length, so the odd
+    // interrupt doesn't read as a slowdown.
+    constexpr double segmentSeconds { 0.5 };
+
+    struct TailCase
+    {
+        const char* name;
+        double sampleRate;
+        CoreMode coreMode;
+        bool sleepEnabled;
+        double seconds;                     // longest the tail is rendered for
+        void (*adjust) (Settings&);         // on top of the parameter defaults, fully wet
+    };
+
+    const TailCase tailCases[] {
+        { "Default", 48000.0, CoreMode::classic, true, 60.0, [] (Settings&) {} },
+        { "LongDecay", 48000.0, CoreMode::fractional, true, 60.0, [] (Settings& s) { s.decayMode = true; s.decayTime = 8.0f; s.dampFreq = 10000.0f; } },
+        { "Bands", 96000.0, CoreMode::reducedRate, true, 60.0, [] (Settings& s) { s.lowDecay = 2.0f; s.highDecay = 0.5f; } },
+
+        // Without the offset, float goes subnormal well inside these 30 s.
+        { "NoSleep", 48000.0, CoreMode::classic, false, 30.0, [] (Settings& s) { s.size = 0.3f; } },
+    };
+
+    struct Segment
+    {
+        double seconds { 0.0 };             // where it starts
+        double nanosecondsPerBlock { 0.0 };
+        double peak { 0.0 };
+        int subnormals { 0 };
+        bool sleeping { false };            // by its end
+    };
+
+    double toDecibels (double gain)
+    {
+        return juce::Decibels::gainToDecibels (gain, -999.0);
+    }
+
+    template <typename SampleType>
+    bool runTail (const TailCase& tailCase, Settings settings, double maxSlowdown, juce::Array<juce::var>& results)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        tailCase.adjust (settings);
+
+        Engine<SampleType> engine;
+        engine.setSettings (settings, true);
+        engine.setCoreMode (tailCase.coreMode);
+        engine.prepare ({ tailCase.sampleRate, static_cast<juce::uint32> (blockSize), 2 });
+        engine.setSleepEnabled (tailCase.sleepEnabled);
+
+        juce::AudioBuffer<SampleType> buffer (2, blockSize);
+        juce::dsp::AudioBlock<SampleType> block (buffer);
+        const juce::dsp::AudioBlock<const SampleType> key (block);
+        const auto settingsAt = [&settings] (int) { return settings; };
+
+        const auto render = [&] (bool isImpulse)
+        {
+            buffer.clear();
+
+            if (isImpulse)
+            {
+                buffer.setSample (0, 0, SampleType (1));
+                buffer.setSample (1, 0, SampleType (1));
+            }
+
+            engine.process (block, key, settingsAt, nullptr, nullptr);
+        };
+
+        // A few blocks first, so the first timed ones don't pay for cold caches.
+        for (int i = 0; i < 64; ++i)
+            render (i == 0);
+
+        engine.reset();
+
+        const auto blocksPerSegment = juce::jmax (1, juce::roundToInt (segmentSeconds * tailCase.sampleRate / blockSize));
+        const auto maxBlocks = static_cast<int> (tailCase.seconds * tailCase.sampleRate / blockSize);
+
+        std::vector<double> blockTimes;
+        std::vector<Segment> segments;
+        Segment segment;
+        int sleptAtBlock = -1;
+        int maxSubnormals = 0;
+
+        for (int i = 0; i < maxBlocks; ++i)
+        {
+            const auto start = Clock::now();
+            render (i == 0);
+            blockTimes.push_back (std::chrono::duration<double, std::nano> (Clock::now() - start).count());
+
+            for (int channel = 0; channel < 2; ++channel)
+                segment.peak = juce::jmax (segment.peak, static_cast<double> (buffer.getMagnitude (channel, 0, blockSize)));
+
+            segment.subnormals = juce::jmax (segment.subnormals, engine.countSubnormals());
+
+            if (sleptAtBlock < 0 && engine.isSleeping())
+                sleptAtBlock = i;
+
+            if (static_cast<int> (blockTimes.size()) == blocksPerSegment)
+            {
+                std::sort (blockTimes.begin(), blockTimes.end());
+                segment.nanosecondsPerBlock = blockTimes[blockTimes.size() / 2];
+                segment.sleeping = engine.isSleeping();
+                segments.push_back (segment);
+                maxSubnormals = juce::jmax (maxSubnormals, segment.subnormals);
+
+                blockTimes.clear();
+                segment = {};
+                segment.seconds = static_cast<double> ((i + 1) * blockSize) / tailCase.sampleRate;
+
+                // A little of the sleep is enough to show what it saves.
+                if (sleptAtBlock >= 0 && i >= sleptAtBlock + 2 * blocksPerSegment)
+                    break;
+            }
+        }
+
+        // Compared with the stretch right after the impulse, while the tail is loud.
+        const auto baseline = segments.front().nanosecondsPerBlock;
+        double worst = 0.0;
+
+        for (const auto& s : segments)
+            if (! s.sleeping)
+                worst = juce::jmax (worst, s.nanosecondsPerBlock);
+
+        const auto slowdown = worst / baseline;
+        const auto slept = sleptAtBlock >= 0;
+        const auto passed = slowdown <= maxSlowdown && maxSubnormals == 0 && (slept || ! tailCase.sleepEnabled);
+
+        const auto name = juce::String (tailCase.name) + (std::is_same_v<SampleType, float> ? " (float)" : " (double)");
+
+        std::cerr << name << ": " << juce::String (slowdown, 2) << "x the block time after the impulse, "
+                  << maxSubnormals << " subnormals, "
+                  << (slept ? "slept after " + juce::String (sleptAtBlock * blockSize / tailCase.sampleRate, 1) + " s"
+                            : juce::String ("never slept"))
+                  << (passed ? "" : "  FAILED") << std::endl;
+
+        juce::Array<juce::var> segmentResults;
+
+        for (const auto& s : segments)
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty ("seconds", s.seconds);
+            object->setProperty ("nsPerBlock", s.nanosecondsPerBlock);
+            object->setProperty ("peakDb", toDecibels (s.peak));
+            object->setProperty ("subnormals", s.subnormals);
+            object->setProperty ("sleeping", s.sleeping);
+            segmentResults.add (juce::var (object));
+        }
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("name", name);
+        result->setProperty ("sampleRate", tailCase.sampleRate);
+        result->setProperty ("blockSize", blockSize);
+        result->setProperty ("sleepEnabled", tailCase.sleepEnabled);
+        result->setProperty ("nsPerBlockAfterImpulse", baseline);
+        result->setProperty ("nsPerBlockWorstAwake", worst);
+        result->setProperty ("slowdown", slowdown);
+        result->setProperty ("maxSubnormals", maxSubnormals);
+        result->setProperty ("sleptAfterSeconds", slept ? juce::var (sleptAtBlock * blockSize / tailCase.sampleRate) : juce::var());
+        result->setProperty ("passed", passed);
+        result->setProperty ("segments", juce::var (segmentResults));
+        results.add (juce::var (result));
+
+        return passed;
+    }
+}
+
+bool runTailBenchmark (double maxSlowdown, juce::Array<juce::var>& results)
+{
+    // What the host would otherwise have set around processBlock(). The reverb has to hold up
+    // without it, as it does on threads the host never touched.
+    juce::FloatVectorOperations::disableDenormalisedNumberSupport (false);
+
+    // Checked by making one, as not every platform reports the flags.
+    volatile float smallestNormal = std::numeric_limits<float>::min();
+
+    if (smallestNormal * 0.5f == 0.0f)
+        std::cerr << "Subnormals are flushed on this machine anyway, the timings can't show a slowdown" << std::endl;
+
+    SimpleRoomReverbAudioProcessor processor;
+    auto settings = getSettings (processor.getPluginState());
+    settings.wetLevel = 1.0f;
+    settings.dryLevel = 0.0f;
+
+    auto passed = true;
+
+    for (const auto& tailCase : tailCases)
+    {
+        passed = runTail<float> (tailCase, settings, maxSlowdown, results) && passed;
+        passed = runTail<double> (tailCase, settings, maxSlowdown, results) && passed;
+    }
+
+    return passed;
+}
@@ -0,0 +1,26 @@
+/*
+  ==============================================================================
+
+    TailBenchmark.h
+    Created: 20 Oct 2026 2:06:15am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "Measure.h"
+
+// Renders an impulse and its whole tail, in float and double, with flush-to-zero and
+// denormals-are-zero switched off. That is where a reverb without protection of its own slows
+// down, as its tail sinks into the subnormal range. Each run checks that:
+//
+// - the time per block stays within `maxSlowdown` of its time right after the impulse,
+// - the tank state never holds a subnormal value,
+// - and, where sleeping is allowed, the tank does go to sleep once the tail has died away.
+//
+// One tail is rendered with sleeping held off, so the offset in the comb filters has to keep
+// the state normal on its own long after float would have gone subnormal. Message thread.
+// Returns false if any check failed.
+bool runTailBenchmark (double maxSlowdown, juce::Array<juce::var>& results);
@@ -0,0 +1,252 @@
+/*
+  ==============================================================================
+
+    ForkJoinPool.cpp
+    Created: 19 Oct 2026 2:04:31pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "ForkJoinPool.h"
+#include <thread>
+
+namespace
+{
+    // How often a helper out of work looks again before parking. An offline render hands out the
+    // next block's jobs soon after the last ones, and catching them here saves a wake-up.
+    constexpr int spinRounds { 64 };
+}
+
+ForkJoinPool::ForkJoinPool()
+{
+    // Sized for a handful of instances bouncing at once, the host already spreads the rest. On a
+    // single core there are no helpers, and the pool never reports itself as running.
+    const auto numHelpers = juce::jmin (4, juce::SystemStats::getNumCpus() - 1);
+
+    for (int i = 0; i < numHelpers; ++i)
+        helpers.add (new Helper (*this, i));
+}
+
+ForkJoinPool::~ForkJoinPool()
+{
+    {
+        const std::lock_guard<std::mutex> lg (lock);
+        shouldExit = true;
+    }
+
+    workAvailable.notify_all();
+
+    for (auto* helper : helpers)
+        helper->stopThread (-1);
+
+    for (const auto& slot : slots)
+        jassert (! slot.isTaken.load());
+}
+
+void ForkJoinPool::start()
+{
+    for (auto* helper : helpers)
+        if (! helper->isThreadRunning())
+            helper->startThread();
+}
+
+bool ForkJoinPool::isRunning() const noexcept
+{
+    for (auto* helper : helpers)
+        if (helper->isThreadRunning())
+            return true;
+
+    return false;
+}
+
+//==============================================================================
+bool ForkJoinPool::takeFront (Group& group, int& index) noexcept
+{
+    auto range = group.range.load();
+
+    for (;;)
+    {
+        const auto front = static_cast<juce::uint32> (range >> 32);
+        const auto back = static_cast<juce::uint32> (range);
+
+        if (front >= back)
+            return false;
+
+        if (group.range.compare_exchange_weak (range, pack (front + 1, back)))
+        {
+            index = static_cast<int> (front);
+            return true;
+        }
+    }
+}
+
+bool ForkJoinPool::takeBack (Group& group, int& index) noexcept
+{
+    auto range = group.range.load();
+
+    for (;;)
+    {
+        const auto front = static_cast<juce::uint32> (range >> 32);
+        const auto back = static_cast<juce::uint32> (range);
+
+        if (front >= back)
+            return false;
+
+        if (group.range.compare_exchange_weak (range, pack (front, back - 1)))
+        {
+            index = static_cast<int> (back - 1);
+            return true;
+        }
+    }
+}
+
+//==============================================================================
+void ForkJoinPool::run (Job job, void* context, int numJobs)
+{
+    if (numJobs <= 0)
+        return;
+
+    Group group;
+    group.job = job;
+    group.context = context;
+    group.range = pack (0, static_cast<juce::uint32> (numJobs));
+    group.remaining = numJobs;
+
+    // With a single job, or every slot taken, the caller does it all.
+    Slot* slot = nullptr;
+
+    if (numJobs > 1)
+    {
+        for (auto& s : slots)
+        {
+            if (! s.isTaken.exchange (true))
+            {
+                slot = &s;
+                slot->group.store (&group);
+                break;
+            }
+        }
+    }
+
+    if (slot != nullptr)
+    {
+        published.fetch_add (1);
+
+        // Parked helpers are woken through the lock, so one that is just about to park can't
+        // miss this. The caller takes one of the jobs itself.
+        if (const auto numToWake = juce::jmin (numJobs - 1, numParked.load()); numToWake > 0)
+        {
+            {
+                const std::lock_guard<std::mutex> lg (lock);
+            }
+
+            for (int i = 0; i < numToWake; ++i)
+                workAvailable.notify_one();
+        }
+    }
+
+    for (int index; takeBack (group, index);)
+    {
+        job (context, index);
+        group.remaining.fetch_sub (1);
+    }
+
+    if (slot != nullptr)
+    {
+        // Out of the slot no helper can find the group any more. The group lives on this stack,
+        // so the call has to outlast the jobs helpers have taken, and the helpers themselves.
+        slot->group.store (nullptr);
+
+        const auto isDone = [&] { return group.remaining.load() == 0 && slot->numVisitors.load() == 0; };
+
+        if (! isDone())
+        {
+            std::unique_lock<std::mutex> ul (lock);
+            groupFinished.wait (ul, isDone);
+        }
+
+        // Only now, so the visitors waited for can't be another caller's.
+        slot->isTaken.store (false);
+    }
+}
+
+bool ForkJoinPool::steal (int firstSlot)
+{
+    for (int i = 0; i < maxGroups; ++i)
+    {
+        auto& slot = slots[static_cast<size_t> ((firstSlot + i) % maxGroups)];
+
+        if (slot.group.load() == nullptr)
+            continue;
+
+        // Counted in before looking, so the caller can't leave between the look and the job.
+        slot.numVisitors.fetch_add (1);
+        auto* group = slot.group.load();
+        int index = 0;
+        const auto found = group != nullptr && takeFront (*group, index);
+
+        if (found)
+        {
+            group->job (group->context, index);
+
+            if (group->remaining.fetch_sub (1) == 1)
+            {
+                // Notifying under the lock means the waiting caller can't miss it between its
+                // check and going to sleep.
+                const std::lock_guard<std::mutex> lg (lock);
+                groupFinished.notify_all();
+            }
+        }
+
+        slot.numVisitors.fetch_sub (1);
+
+        // A caller only waits for visitors after taking its group out of the slot, so if the
+        // group seen above isn't there any more, it may be waiting for this one.
+        if (group == nullptr || slot.group.load() != group)
+        {
+            const std::lock_guard<std::mutex> lg (lock);
+            groupFinished.notify_all();
+        }
+
+        if (found)
+            return true;
+    }
+
+    return false;
+}
+
+void ForkJoinPool::helperLoop (int index)
+{
+    // Callers take the first free slot, so starting from a different one each keeps the helpers
+    // from all queuing up on the same caller.
+    const auto firstSlot = index % maxGroups;
+
+    for (;;)
+    {
+        // Read before looking, so anything published after the look shows up as a change.
+        const auto seen = published.load();
+
+        if (steal (firstSlot))
+            continue;
+
+        auto isNew = false;
+
+        for (int i = 0; i < spinRounds && ! isNew; ++i)
+        {
+            std::this_thread::yield();
+            isNew = published.load() != seen;
+        }
+
+        if (isNew)
+            continue;
+
+        std::unique_lock<std::mutex> ul (lock);
+        numParked.fetch_add (1);
+        workAvailable.wait (ul, [&] { return shouldExit || published.load() != seen; });
+        numParked.fetch_sub (1);
+
+        if (shouldExit)
+            return;
+    }
+}
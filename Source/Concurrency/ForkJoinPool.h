@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    ForkJoinPool.h
+    Created: 19 Oct 2026 2:04:31pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <condition_variable>
+#include <mutex>
+
+// A few helper threads shared by every instance, for splitting offline renders into independent
+// jobs. Work stealing: each run() publishes its jobs as a range in a slot of its own and works
+// through it from the back, while idle helpers steal single jobs from the front of whichever
+// range they come to first, each starting its search at a different slot. Taking a job is one
+// compare-and-swap, with no queue and no lock shared between instances. The caller takes part in
+// its own jobs, so a call always finishes even when every helper is busy with another instance.
+//
+// This is kept apart from WorkerPool on purpose. Its threads run long, low-priority background
+// work such as an IR export, and a render that waits for its jobs can't be queued behind that.
+//
+// Helpers park on a lock once they have been out of work for a while, and start() creates threads,
+// so this is only for non-realtime processing, and start() only for the message thread or
+// prepareToPlay().
+class ForkJoinPool
+{
+public:
+    ForkJoinPool();
+    ~ForkJoinPool();
+
+    // Starts the helper threads if they aren't running yet.
+    void start();
+    bool isRunning() const noexcept;
+
+    using Job = void (*) (void* context, int index);
+
+    // Calls job (context, index) for every index in [0, numJobs) and returns once all have finished.
+    void run (Job job, void* context, int numJobs);
+
+    template <typename Callable>
+    void run (int numJobs, Callable& callable)
+    {
+        run ([] (void* context, int index) { (*static_cast<Callable*> (context)) (index); }, &callable, numJobs);
+    }
+
+    // Most calls to run() that can be helped at once. Any more run on their callers alone.
+    static constexpr int maxGroups { 16 };
+
+private:
+    struct Group
+    {
+        Job job { nullptr };
+        void* context { nullptr };
+
+        // The jobs nobody has taken yet, [front, back), in one word so the caller taking from the
+        // back and a helper taking from the front can't both get the last one.
+        std::atomic<juce::uint64> range { 0 };
+        std::atomic<int> remaining { 0 };
+    };
+
+    struct Slot
+    {
+        std::atomic<bool> isTaken { false };    // by a caller, from before its group goes in until it leaves
+        std::atomic<Group*> group { nullptr };
+
+        // Helpers looking into the slot. The caller only leaves once this is back to zero, since
+        // the group lives on its stack.
+        std::atomic<int> numVisitors { 0 };
+    };
+
+    class Helper : public juce::Thread
+    {
+    public:
+        Helper (ForkJoinPool& p, int i) : juce::Thread ("Reverb fork-join helper"), pool (p), index (i) {}
+        void run() override { pool.helperLoop (index); }
+
+    private:
+        ForkJoinPool& pool;
+        const int index;
+    };
+
+    static juce::uint64 pack (juce::uint32 front, juce::uint32 back) noexcept { return (juce::uint64 (front) << 32) | back; }
+    static bool takeFront (Group& group, int& index) noexcept;
+    static bool takeBack (Group& group, int& index) noexcept;
+
+    // Takes one job from any group, starting at `firstSlot`, runs it and returns true, or returns
+    // false if there was nothing to take.
+    bool steal (int firstSlot);
+
+    void helperLoop (int index);
+
+    std::array<Slot, maxGroups> slots;
+
+    // Moved on whenever a group goes into a slot, for parked helpers to wake up to.
+    std::atomic<juce::uint32> published { 0 };
+
+    std::mutex lock;
+    std::condition_variable workAvailable, groupFinished;
+    std::atomic<int> numParked { 0 };
+    bool shouldExit { false };      // guarded by lock
+
+    juce::OwnedArray<Helper> helpers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ForkJoinPool)
+};
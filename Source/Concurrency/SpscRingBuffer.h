@@ -0,0 +1,105 @@
+/*
+  ==============================================================================
+
+    SpscRingBuffer.h
+    Created: 19 Oct 2026 3:12:47pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Wait-free queue for one producer thread and one consumer thread, for streaming samples or small
+// trivially-copyable messages from the audio thread to the editor (or back). Neither side ever
+// blocks or allocates; a full queue simply accepts fewer items, an empty one returns fewer.
+template <typename Type>
+class SpscRingBuffer
+{
+public:
+    static_assert (std::is_trivially_copyable_v<Type>, "Items are copied around with no ownership");
+
+    SpscRingBuffer() = default;
+    explicit SpscRingBuffer (int minCapacity) { setCapacity (minCapacity); }
+
+    // Rounds up to a power of two and empties the queue. Neither side may be running.
+    void setCapacity (int minCapacity)
+    {
+        const auto capacity = juce::nextPowerOfTwo (juce::jmax (2, minCapacity));
+        items.assign (static_cast<size_t> (capacity), Type {});
+        mask = static_cast<std::uint32_t> (capacity - 1);
+        writePosition.store (0);
+        readPosition.store (0);
+    }
+
+    int getCapacity() const noexcept { return static_cast<int> (mask) + 1; }
+
+    //==============================================================================
+    // Producer side.
+
+    int getFreeSpace() const noexcept
+    {
+        return getCapacity() - static_cast<int> (writePosition.load (std::memory_order_relaxed) - readPosition.load (std::memory_order_acquire));
+    }
+
+    // Appends up to numItems and returns how many fitted.
+    int push (const Type* source, int numItems) noexcept
+    {
+        const auto write = writePosition.load (std::memory_order_relaxed);
+        const auto count = juce::jmin (numItems, getCapacity() - static_cast<int> (write - readPosition.load (std::memory_order_acquire)));
+
+        for (int i = 0; i < count; ++i)
+            items[(write + static_cast<std::uint32_t> (i)) & mask] = source[i];
+
+        writePosition.store (write + static_cast<std::uint32_t> (count), std::memory_order_release);
+        return count;
+    }
+
+    bool push (const Type& item) noexcept { return push (&item, 1) == 1; }
+
+    //==============================================================================
+    // Consumer side.
+
+    int getNumReady() const noexcept
+    {
+        return static_cast<int> (writePosition.load (std::memory_order_acquire) - readPosition.load (std::memory_order_relaxed));
+    }
+
+    // Removes up to numItems into dest and returns how many there were.
+    int pop (Type* dest, int numItems) noexcept
+    {
+        const auto read = readPosition.load (std::memory_order_relaxed);
+        const auto count = juce::jmin (numItems, static_cast<int> (writePosition.load (std::memory_order_acquire) - read));
+
+        for (int i = 0; i < count; ++i)
+            dest[i] = items[(read + static_cast<std::uint32_t> (i)) & mask];
+
+        readPosition.store (read + static_cast<std::uint32_t> (count), std::memory_order_release);
+        return count;
+    }
+
+    bool pop (Type& item) noexcept { return pop (&item, 1) == 1; }
+
+    // Drops everything currently queued.
+    void discardAll() noexcept
+    {
+        readPosition.store (writePosition.load (std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    std::vector<Type> items;
+    std::uint32_t mask { 0 };
+
+    // Free-running counters, wrapping is harmless since only their difference is used. Each sits
+    // on its own cache line so the two threads don't keep stealing it from each other.
+    alignas (64) std::atomic<std::uint32_t> writePosition { 0 };
+    alignas (64) std::atomic<std::uint32_t> readPosition { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (SpscRingBuffer)
+};
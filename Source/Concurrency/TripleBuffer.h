@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    TripleBuffer.h
+    Created: 19 Oct 2026 3:12:47pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <cstdint>
+
+// Hands the latest value of something from one writer thread to one reader thread. The writer
+// always has a slot of its own and the reader always has a complete value, so neither ever waits,
+// and values the reader didn't get round to are simply overwritten.
+template <typename Type>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+
+    // Writer side: publishes a complete value, replacing any the reader hasn't picked up yet.
+    void write (const Type& value) noexcept
+    {
+        slots[writeSlot] = value;
+        const auto previous = shared.exchange (static_cast<std::uint8_t> (writeSlot | freshBit), std::memory_order_acq_rel);
+        writeSlot = previous & slotMask;
+    }
+
+    // Reader side: copies the latest value into dest and returns true if it is new since last time.
+    bool read (Type& dest) noexcept
+    {
+        if ((shared.load (std::memory_order_relaxed) & freshBit) == 0)
+            return false;
+
+        const auto previous = shared.exchange (static_cast<std::uint8_t> (readSlot), std::memory_order_acq_rel);
+        readSlot = previous & slotMask;
+        dest = slots[readSlot];
+        return true;
+    }
+
+private:
+    static constexpr std::uint8_t slotMask { 0x3 };
+    static constexpr std::uint8_t freshBit { 0x4 };
+
+    Type slots[3] {};
+    int writeSlot { 0 };
+    int readSlot { 1 };
+
+    // The slot that is neither being written nor read, plus whether it holds an unread value.
+    std::atomic<std::uint8_t> shared { 2 };
+
+    JUCE_DECLARE_NON_COPYABLE (TripleBuffer)
+};
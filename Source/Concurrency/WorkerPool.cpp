@@ -0,0 +1,152 @@
+/*
+  ==============================================================================
+
+    WorkerPool.cpp
+    Created: 19 Oct 2026 11:59:40pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool()
+{
+    queue.reserve (static_cast<size_t> (queueCapacity));
+
+    // None of the work is urgent enough to compete with the host for cores, and one thread
+    // already keeps up with it. The second is there so a long export doesn't hold up the rest.
+    const auto numWorkers = juce::jlimit (1, 2, juce::SystemStats::getNumCpus() - 1);
+
+    for (int i = 0; i < numWorkers; ++i)
+        workers.add (new Worker (*this))->startThread();
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        // Every token has to be cancelled by now, which left nothing queued or running.
+        const std::lock_guard<std::mutex> lg (lock);
+        jassert (queue.empty());
+        shouldExit = true;
+    }
+
+    workAvailable.notify_all();
+
+    for (auto* worker : workers)
+        worker->stopThread (-1);
+}
+
+//==============================================================================
+WorkerPool::Token::Token (WorkerPool& p)
+    : pool (p)
+{
+}
+
+WorkerPool::Token::~Token()
+{
+    cancel();
+}
+
+bool WorkerPool::Token::submit (Priority priority, Task task, int delayMilliseconds)
+{
+    {
+        const std::lock_guard<std::mutex> lg (pool.lock);
+
+        if (cancelled || static_cast<int> (pool.queue.size()) >= queueCapacity)
+            return false;
+
+        pool.add (*this, priority, std::move (task), Clock::now() + std::chrono::milliseconds (delayMilliseconds));
+    }
+
+    pool.workAvailable.notify_one();
+    return true;
+}
+
+void WorkerPool::Token::cancel()
+{
+    std::unique_lock<std::mutex> ul (pool.lock);
+    cancelled = true;
+
+    auto& queue = pool.queue;
+    queue.erase (std::remove_if (queue.begin(), queue.end(), [this] (const Entry& e) { return e.token == this; }), queue.end());
+
+    // A running task can't requeue itself any more, it only has to finish.
+    pool.taskFinished.wait (ul, [this] { return numRunning == 0; });
+}
+
+//==============================================================================
+void WorkerPool::add (Token& token, Priority priority, Task task, Clock::time_point due)
+{
+    queue.push_back ({ &token, priority, due, nextSequence++, std::move (task) });
+}
+
+std::vector<WorkerPool::Entry>::iterator WorkerPool::findNext()
+{
+    // Anything due comes before anything that isn't. Among due tasks the priority decides, then
+    // the order they came in. Among the rest, the one due first.
+    const auto now = Clock::now();
+
+    return std::min_element (queue.begin(), queue.end(), [now] (const Entry& a, const Entry& b)
+    {
+        const auto aIsDue = a.due <= now;
+        const auto bIsDue = b.due <= now;
+
+        if (aIsDue != bIsDue)
+            return aIsDue;
+
+        if (! aIsDue)
+            return a.due < b.due;
+
+        if (a.priority != b.priority)
+            return a.priority > b.priority;
+
+        return a.sequence < b.sequence;
+    });
+}
+
+void WorkerPool::workerLoop()
+{
+    std::unique_lock<std::mutex> ul (lock);
+
+    for (;;)
+    {
+        if (shouldExit)
+            return;
+
+        const auto next = findNext();
+
+        if (next == queue.end())
+        {
+            workAvailable.wait (ul);
+            continue;
+        }
+
+        if (next->due > Clock::now())
+        {
+            // Woken early by new work, which may be due sooner.
+            workAvailable.wait_until (ul, next->due);
+            continue;
+        }
+
+        auto entry = std::move (*next);
+        queue.erase (next);
+        ++entry.token->numRunning;
+
+        ul.unlock();
+        const auto waitMilliseconds = entry.task();
+        ul.lock();
+
+        --entry.token->numRunning;
+
+        if (waitMilliseconds >= 0 && ! entry.token->cancelled)
+        {
+            // Taking its own place back, so this doesn't count against the capacity.
+            entry.due = Clock::now() + std::chrono::milliseconds (waitMilliseconds);
+            entry.sequence = nextSequence++;
+            queue.push_back (std::move (entry));
+        }
+
+        taskFinished.notify_all();
+    }
+}
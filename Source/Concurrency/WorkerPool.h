@@ -0,0 +1,115 @@
+/*
+  ==============================================================================
+
+    WorkerPool.h
+    Created: 19 Oct 2026 11:59:40pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+// The background threads for everything that isn't audio: analysis, room models, exports. One
+// pool serves every instance in the process, held through a juce::SharedResourcePointer, so a
+// session with hundreds of instances still has a couple of threads instead of hundreds.
+//
+// Work goes in as tasks through a Token, one per owner. A task returns how long it wants to wait
+// before running again, or `done`, which lets a task poll or work through a long job a piece at a
+// time without holding a thread. The queue is bounded and submitting to a full one fails. Due
+// tasks run highest priority first, and in submission order within a priority.
+//
+// Locks and allocations are involved, so nothing here may be called from the audio thread.
+class WorkerPool
+{
+public:
+    enum class Priority
+    {
+        low,
+        normal,
+        high
+    };
+
+    // What a task returns when it doesn't want to run again.
+    static constexpr int done { -1 };
+
+    using Task = std::function<int()>;
+
+    // Cancelling a token drops its queued tasks and waits for any of them that is running, after
+    // which nothing the tasks refer to is touched again. Destroying it cancels it, so it should
+    // be declared after everything its tasks use, and after the pointer that keeps the pool alive.
+    class Token
+    {
+    public:
+        explicit Token (WorkerPool& pool);
+        ~Token();
+
+        // Runs the task after `delayMilliseconds`. Returns false once cancelled or while the
+        // queue is full.
+        bool submit (Priority priority, Task task, int delayMilliseconds = 0);
+
+        // Not from one of the token's own tasks, which would wait for itself.
+        void cancel();
+
+    private:
+        friend class WorkerPool;
+
+        WorkerPool& pool;
+
+        // Guarded by the pool's lock.
+        int numRunning { 0 };
+        bool cancelled { false };
+
+        JUCE_DECLARE_NON_COPYABLE (Token)
+    };
+
+    WorkerPool();
+    ~WorkerPool();
+
+    // Most tasks waiting at once, across every instance.
+    static constexpr int queueCapacity { 1024 };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        Token* token;
+        Priority priority;
+        Clock::time_point due;
+        juce::int64 sequence;
+        Task task;
+    };
+
+    class Worker : public juce::Thread
+    {
+    public:
+        explicit Worker (WorkerPool& p) : juce::Thread ("Reverb background worker"), pool (p) {}
+        void run() override { pool.workerLoop(); }
+
+    private:
+        WorkerPool& pool;
+    };
+
+    void workerLoop();
+    void add (Token& token, Priority priority, Task task, Clock::time_point due);
+
+    // The entry to run next and when it is due, or the end of the queue if it is empty.
+    std::vector<Entry>::iterator findNext();
+
+    std::mutex lock;
+    std::condition_variable workAvailable, taskFinished;
+    std::vector<Entry> queue;
+    juce::int64 nextSequence { 0 };
+    bool shouldExit { false };
+
+    juce::OwnedArray<Worker> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WorkerPool)
+};
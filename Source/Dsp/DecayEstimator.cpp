@@ -0,0 +1,99 @@
+/*
+  ==============================================================================
+
+    DecayEstimator.cpp
+    Created: 19 Oct 2026 6:02:14pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "DecayEstimator.h"
+#include "Tunings.h"
+#include <juce_core/juce_core.h>
+#include <complex>
+
+float DecayEstimate::getLongest() const noexcept
+{
+    return *std::max_element (std::begin (rt60), std::end (rt60));
+}
+
+DecayEstimate estimateDecay (const Settings& settings, double sampleRate)
+{
+    DecayEstimate estimate;
+
+    // Hold keeps the tank circulating at unity gain and the loop modes replay it, either way the
+    // tail doesn't end until the freeze is released.
+    if (settings.freeze)
+    {
+        std::fill (std::begin (estimate.rt60), std::end (estimate.rt60), std::numeric_limits<float>::infinity());
+        return estimate;
+    }
+
+    const auto intSampleRate = static_cast<int> (sampleRate);
+    const auto decayPerSample = settings.decayMode ? Tunings::decayPerSample (settings.decayTime, sampleRate) : 0.0;
+    const auto damp = settings.decayMode ? Tunings::dampingForFrequency (settings.dampFreq, sampleRate)
+                                         : static_cast<double> (Tunings::dampingForDamp (settings.damp));
+
+    // In the decay-time mode every comb gets its own feedback, otherwise they share one.
+    auto feedbackFor = [&] (int length)
+    {
+        return settings.decayMode ? Tunings::feedbackForDecay (length, decayPerSample)
+                                  : static_cast<double> (Tunings::feedbackForRoomSize (settings.size));
+    };
+
+    const auto hasBands = settings.lowDecay != 1.0f || settings.midDecay != 1.0f || settings.highDecay != 1.0f;
+    const auto lowCoefficient = 1.0 - Tunings::dampingForFrequency (juce::jmin (static_cast<double> (settings.lowCrossover), 0.45 * sampleRate), sampleRate);
+    const auto highCoefficient = 1.0 - Tunings::dampingForFrequency (juce::jmin (static_cast<double> (settings.highCrossover), 0.45 * sampleRate), sampleRate);
+
+    for (int band = 0; band < DecayEstimate::numBands; ++band)
+    {
+        const auto freq = static_cast<double> (DecayEstimate::bandFrequencies[band]);
+
+        if (freq >= sampleRate * 0.5)
+            continue;
+
+        // The damping is a one-pole lowpass (1 - d) / (1 - d z^-1) inside the loop.
+        const auto omega = juce::MathConstants<double>::twoPi * freq / sampleRate;
+        const auto lowPassGain = (1.0 - damp) / std::sqrt (1.0 - 2.0 * damp * std::cos (omega) + damp * damp);
+
+        // The band weighting mixes the loop with the two one-poles c / (1 - (1 - c) z^-1) that
+        // split it, as high + (mid - high) * below high + (low - mid) * below low.
+        const auto z = std::polar (1.0, -omega);
+        const auto belowLow = lowCoefficient / (1.0 - (1.0 - lowCoefficient) * z);
+        const auto belowHigh = highCoefficient / (1.0 - (1.0 - highCoefficient) * z);
+
+        auto bandWeighting = [&] (double feedback)
+        {
+            if (! hasBands)
+                return 1.0;
+
+            const auto low = Tunings::bandGainForMultiplier (feedback, settings.lowDecay);
+            const auto mid = Tunings::bandGainForMultiplier (feedback, settings.midDecay);
+            const auto high = Tunings::bandGainForMultiplier (feedback, settings.highDecay);
+
+            return std::abs (high + (mid - high) * belowHigh + (low - mid) * belowLow);
+        };
+
+        // Each trip round a comb of length N loses -20 log10 (loopGain) dB, so 60 dB takes
+        // -3 N / log10 (loopGain) samples. The slowest comb sets how long the tail lasts.
+        auto longest = 0.0;
+
+        for (auto spread : { 0, Tunings::stereoSpread })
+        {
+            for (auto tuning : Tunings::combs)
+            {
+                const auto length = Tunings::scaleLength (tuning + spread, intSampleRate);
+                const auto feedback = feedbackFor (length);
+                const auto loopGain = feedback * lowPassGain * bandWeighting (feedback);
+
+                longest = juce::jmax (longest, loopGain < 1.0 ? -3.0 * length / (std::log10 (loopGain) * sampleRate)
+                                                              : std::numeric_limits<double>::infinity());
+            }
+        }
+
+        estimate.rt60[band] = static_cast<float> (longest);
+    }
+
+    return estimate;
+}
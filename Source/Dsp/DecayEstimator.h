@@ -0,0 +1,32 @@
+/*
+  ==============================================================================
+
+    DecayEstimator.h
+    Created: 19 Oct 2026 6:02:14pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../Settings.h"
+
+// Reverb time per octave band, in seconds. Infinite while a freeze holds the tail.
+struct DecayEstimate
+{
+    static constexpr int numBands { 7 };
+    static constexpr float bandFrequencies[numBands] { 125.0f, 250.0f, 500.0f, 1000.0f, 2000.0f, 4000.0f, 8000.0f };
+    static constexpr int midBand { 3 };
+
+    float rt60[numBands] {};
+
+    float getLongest() const noexcept;
+};
+
+// Predicts the RT60 of the comb network from the loop gain of each comb, which is its feedback
+// times the response of the damping filter and the band weighting inside the loop. Covers both
+// the size/damp and the decay-time parameterisations. The all-passes and the output filters
+// are left out: they change the tail's colour far more than its length. Cheap enough to run on
+// every parameter change.
+DecayEstimate estimateDecay (const Settings& settings, double sampleRate);
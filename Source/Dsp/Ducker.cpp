@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    Ducker.cpp
+    Created: 19 Oct 2026 11:48:20pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Ducker.h"
+
+template <typename SampleType>
+void Ducker<SampleType>::prepare (double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    // The times may have been set before the rate was known.
+    setParameters (parameters);
+    reset();
+}
+
+template <typename SampleType>
+void Ducker<SampleType>::reset() noexcept
+{
+    envelope = SampleType (0);
+}
+
+template <typename SampleType>
+void Ducker<SampleType>::setParameters (const Parameters& newParams) noexcept
+{
+    parameters = newParams;
+    thresholdGain = juce::Decibels::decibelsToGain (static_cast<SampleType> (newParams.threshold));
+    floorGain = juce::Decibels::decibelsToGain (static_cast<SampleType> (-newParams.depth), SampleType (-200));
+
+    // The envelope covers 1 - 1/e of a step in the attack or release time.
+    auto coefficientFor = [this] (float milliseconds)
+    {
+        return static_cast<SampleType> (std::exp (-1000.0 / (juce::jmax (0.01, static_cast<double> (milliseconds)) * sampleRate)));
+    };
+
+    attackCoefficient = coefficientFor (newParams.attack);
+    releaseCoefficient = coefficientFor (newParams.release);
+}
+
+//==============================================================================
+template class Ducker<float>;
+template class Ducker<double>;
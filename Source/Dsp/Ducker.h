@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+
+    Ducker.h
+    Created: 19 Oct 2026 11:48:20pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "MicroBlock.h"
+#include "PeakDetector.h"
+
+// Turns the wet signal down while a key signal, the main input or a sidechain, is above a
+// threshold. Every decibel the key's envelope goes over the threshold takes a decibel off the
+// wet signal, up to the depth.
+//
+// The peak of the key across its channels is found a whole slice at a time with vector ops. Only
+// the envelope follower, a one-pole with separate attack and release, has to run per sample, and
+// the gain law is a clamped ratio of linear levels, so there are no logarithms on the audio path.
+template <typename SampleType>
+class Ducker
+{
+public:
+    struct Parameters
+    {
+        float threshold { -24.0f };     // dB
+        float depth { 0.0f };           // most dB taken off, 0 turns ducking off
+        float attack { 5.0f };          // ms
+        float release { 250.0f };       // ms
+    };
+
+    void prepare (double sampleRate);
+    void reset() noexcept;
+
+    void setParameters (const Parameters& newParams) noexcept;
+
+    // While this is false process() doesn't have to be called and the wet signal is left alone.
+    bool isActive() const noexcept { return floorGain < SampleType (1); }
+
+    // Writes the wet gains for a slice of at most MicroBlock::size samples of the key.
+    void process (const juce::dsp::AudioBlock<const SampleType>& key, SampleType* gains) noexcept
+    {
+        const auto n = static_cast<int> (key.getNumSamples());
+
+        alignas (16) SampleType peak[MicroBlock::size];
+        PeakDetector::acrossChannels (key, peak);
+
+        for (int i = 0; i < n; ++i)
+        {
+            const auto coefficient = peak[i] > envelope ? attackCoefficient : releaseCoefficient;
+            envelope = peak[i] + coefficient * (envelope - peak[i]);
+
+            // threshold / envelope is the gain that takes the overshoot off in full.
+            gains[i] = envelope > thresholdGain ? juce::jmax (floorGain, thresholdGain / envelope) : SampleType (1);
+        }
+
+        // Keeps a long release from ending up in the denormal range.
+        if (envelope < minEnvelope)
+            envelope = SampleType (0);
+    }
+
+private:
+    static constexpr SampleType minEnvelope { SampleType (1.0e-8) };
+
+    double sampleRate { 44100.0 };
+    Parameters parameters;
+
+    SampleType thresholdGain { 1 };
+    SampleType floorGain { 1 };
+    SampleType attackCoefficient { 0 };
+    SampleType releaseCoefficient { 0 };
+
+    SampleType envelope { 0 };
+};
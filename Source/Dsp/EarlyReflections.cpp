@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    EarlyReflections.cpp
+    Created: 19 Oct 2026 11:02:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "EarlyReflections.h"
+
+template <typename SampleType>
+void EarlyReflections<SampleType>::prepare (double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    // A tap reads a whole slice back from its delay, so the line has to cover both.
+    const auto maxDelay = static_cast<int> (std::ceil (ReflectionTaps::maxDelaySeconds * sampleRate));
+    buffer.assign (static_cast<size_t> (maxDelay + 2 * MicroBlock::size), SampleType (0));
+
+    fadeStep = static_cast<SampleType> (1.0 / (fadeSeconds * sampleRate));
+    current = toSamples (latest);
+    hasPendingTaps = false;
+
+    reset();
+}
+
+template <typename SampleType>
+void EarlyReflections<SampleType>::reset()
+{
+    std::fill (buffer.begin(), buffer.end(), SampleType (0));
+    writeIndex = 0;
+    sliceStart = 0;
+    silentSamples = static_cast<int> (buffer.size());
+
+    // Nothing is playing, so new taps can take over straight away.
+    if (hasPendingTaps)
+        current = pending;
+
+    hasPendingTaps = false;
+    fading = false;
+}
+
+template <typename SampleType>
+void EarlyReflections<SampleType>::setTaps (const ReflectionTaps& newTaps) noexcept
+{
+    latest = newTaps;
+
+    if (sampleRate <= 0.0)
+        return;
+
+    pending = toSamples (newTaps);
+    hasPendingTaps = true;
+}
+
+template <typename SampleType>
+typename EarlyReflections<SampleType>::Taps EarlyReflections<SampleType>::toSamples (const ReflectionTaps& taps) const noexcept
+{
+    Taps converted;
+    converted.numTaps = taps.numTaps;
+    converted.tailGain = static_cast<SampleType> (taps.tailGain);
+
+    // A reflection lands within half a sample of where it should, which is far finer than the
+    // geometry is.
+    for (int i = 0; i < taps.numTaps; ++i)
+    {
+        converted.delays[i] = juce::roundToInt (static_cast<double> (taps.delaySeconds[i]) * sampleRate);
+        converted.leftGains[i] = static_cast<SampleType> (taps.leftGains[i]);
+        converted.rightGains[i] = static_cast<SampleType> (taps.rightGains[i]);
+        converted.longestDelay = juce::jmax (converted.longestDelay, converted.delays[i]);
+    }
+
+    return converted;
+}
+
+//==============================================================================
+template class EarlyReflections<float>;
+template class EarlyReflections<double>;
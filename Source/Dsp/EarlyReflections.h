@@ -0,0 +1,179 @@
+/*
+  ==============================================================================
+
+    EarlyReflections.h
+    Created: 19 Oct 2026 11:02:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "ImageSource.h"
+#include "MicroBlock.h"
+
+// Renders a set of image-source taps as a sparse multi-tap delay with a stereo output. The input
+// goes into one delay line long enough for the largest room, and every tap reads a micro-block of
+// it as one contiguous run, so the work per slice depends on the number of taps and nothing else.
+//
+// A new set of taps is crossfaded in over the old one, since moving a tap would click.
+template <typename SampleType>
+class EarlyReflections
+{
+public:
+    void prepare (double sampleRate);
+    void reset();
+
+    // Audio thread. Waits for a fade that is already running to finish before it starts.
+    void setTaps (const ReflectionTaps& newTaps) noexcept;
+
+    // Appends a slice of at most MicroBlock::size samples to the delay line. Has to be called for
+    // every slice, rendered or not, so the line stays continuous.
+    void write (const SampleType* input, int numSamples) noexcept
+    {
+        jassert (numSamples <= MicroBlock::size);
+
+        const auto size = static_cast<int> (buffer.size());
+        sliceStart = writeIndex;
+
+        for (int done = 0; done < numSamples;)
+        {
+            const auto run = juce::jmin (numSamples - done, size - writeIndex);
+            juce::FloatVectorOperations::copy (buffer.data() + writeIndex, input + done, run);
+
+            done += run;
+            writeIndex += run;
+
+            if (writeIndex == size)
+                writeIndex = 0;
+        }
+
+        const auto range = juce::FloatVectorOperations::findMinAndMax (input, numSamples);
+        const auto isSilent = juce::jmax (-range.getStart(), range.getEnd()) < silenceThreshold;
+
+        // Capped, the line is never longer than this anyway.
+        silentSamples = isSilent ? juce::jmin (silentSamples + numSamples, size) : 0;
+    }
+
+    // What the sum of both outputs is scaled by to feed the tail at the level of the direct sound.
+    SampleType getTailGain() const noexcept { return current.tailGain; }
+
+    // Writes the reflections of the slice just written into `left` and `right`. Returns false
+    // without touching them once every tap is reading silence.
+    bool render (SampleType* left, SampleType* right, int numSamples) noexcept
+    {
+        if (! fading && hasPendingTaps)
+        {
+            previous = current;
+            current = pending;
+            hasPendingTaps = false;
+            fading = true;
+            fadePosition = SampleType (0);
+        }
+
+        const auto longestDelay = juce::jmax (current.longestDelay, fading ? previous.longestDelay : 0);
+
+        if (silentSamples > longestDelay + numSamples)
+        {
+            fading = false;
+            return false;
+        }
+
+        renderTaps (current, left, right, numSamples);
+
+        if (! fading)
+            return true;
+
+        // Blends old into new as old + (new - old) * ramp, the new taps having been rendered in place.
+        alignas (16) SampleType oldLeft[MicroBlock::size];
+        alignas (16) SampleType oldRight[MicroBlock::size];
+        alignas (16) SampleType ramp[MicroBlock::size];
+
+        renderTaps (previous, oldLeft, oldRight, numSamples);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            fadePosition = juce::jmin (SampleType (1), fadePosition + fadeStep);
+            ramp[i] = fadePosition;
+        }
+
+        auto blend = [&ramp, numSamples] (SampleType* out, const SampleType* old)
+        {
+            juce::FloatVectorOperations::subtract (out, old, numSamples);
+            juce::FloatVectorOperations::multiply (out, ramp, numSamples);
+            juce::FloatVectorOperations::add (out, old, numSamples);
+        };
+
+        blend (left, oldLeft);
+        blend (right, oldRight);
+
+        fading = fadePosition < SampleType (1);
+        return true;
+    }
+
+private:
+    struct Taps
+    {
+        int numTaps { 0 };
+        int delays[ReflectionTaps::maxTaps] {};
+        SampleType leftGains[ReflectionTaps::maxTaps] {};
+        SampleType rightGains[ReflectionTaps::maxTaps] {};
+        int longestDelay { 0 };
+        SampleType tailGain { 0 };
+    };
+
+    Taps toSamples (const ReflectionTaps& taps) const noexcept;
+
+    // Each tap is a scaled copy of a stretch of the line, split in two where it wraps around.
+    // Two vector multiply-adds per stretch cover both channels.
+    void renderTaps (const Taps& taps, SampleType* left, SampleType* right, int numSamples) const noexcept
+    {
+        juce::FloatVectorOperations::clear (left, numSamples);
+        juce::FloatVectorOperations::clear (right, numSamples);
+
+        const auto size = static_cast<int> (buffer.size());
+
+        for (int t = 0; t < taps.numTaps; ++t)
+        {
+            auto readIndex = sliceStart - taps.delays[t];
+
+            if (readIndex < 0)
+                readIndex += size;
+
+            for (int done = 0; done < numSamples;)
+            {
+                const auto run = juce::jmin (numSamples - done, size - readIndex);
+                const auto* delayed = buffer.data() + readIndex;
+
+                juce::FloatVectorOperations::addWithMultiply (left + done, delayed, taps.leftGains[t], run);
+                juce::FloatVectorOperations::addWithMultiply (right + done, delayed, taps.rightGains[t], run);
+
+                done += run;
+                readIndex = 0;
+            }
+        }
+    }
+
+    static constexpr double fadeSeconds { 0.02 };
+
+    // -120 dB, as for the tank.
+    static constexpr SampleType silenceThreshold { SampleType (1.0e-6) };
+
+    double sampleRate { 0.0 };
+
+    std::vector<SampleType> buffer;
+    int writeIndex { 0 };
+    int sliceStart { 0 };
+    int silentSamples { 0 };
+
+    // The taps as they came in, kept to convert them again at a new sample rate.
+    ReflectionTaps latest;
+
+    Taps current, previous, pending;
+    bool hasPendingTaps { false };
+    bool fading { false };
+    SampleType fadePosition { 0 };
+    SampleType fadeStep { 0 };
+};
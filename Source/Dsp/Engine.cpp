@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    Engine.cpp
+    Created: 19 Oct 2026 2:55:17pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Engine.h"
+
+template <typename SampleType>
+void Engine<SampleType>::prepare (const juce::dsp::ProcessSpec& spec)
+{
+    reverb.prepare (spec);
+    lowPassFilter.prepare (spec);
+    highPassFilter.prepare (spec);
+    ducker.prepare (spec.sampleRate);
+
+    duckGains.resize (static_cast<size_t> (reverb.getBatchCapacity()));
+    slices.resize (static_cast<size_t> (reverb.getBatchCapacity() / MicroBlock::size + 2));
+    numSlices = 0;
+    microBlockPhase = 0;
+}
+
+template <typename SampleType>
+void Engine<SampleType>::reset()
+{
+    reverb.reset();
+    lowPassFilter.reset();
+    highPassFilter.reset();
+    ducker.reset();
+    microBlockPhase = 0;
+}
+
+template <typename SampleType>
+void Engine<SampleType>::setSettings (const Settings& newSettings, bool force)
+{
+    // Outside of process() there is no batch in flight, so the filters can follow straight away.
+    if (force)
+        updateFilters (newSettings.lowPassFreq, newSettings.highPassFreq);
+    
+    if (force
+        || newSettings.size != settings.size
+        || newSettings.damp != settings.damp
+        || newSettings.width != settings.width
+        || newSettings.wetLevel != settings.wetLevel
+        || newSettings.freeze != settings.freeze
+        || newSettings.freezeMode != settings.freezeMode
+        || newSettings.decayMode != settings.decayMode
+        || newSettings.decayTime != settings.decayTime
+        || newSettings.dampFreq != settings.dampFreq
+        || newSettings.lowDecay != settings.lowDecay
+        || newSettings.midDecay != settings.midDecay
+        || newSettings.highDecay != settings.highDecay
+        || newSettings.lowCrossover != settings.lowCrossover
+        || newSettings.highCrossover != settings.highCrossover
+        || newSettings.earlyLevel != settings.earlyLevel
+        || newSettings.gate != settings.gate
+        || newSettings.gateThreshold != settings.gateThreshold
+        || newSettings.gateHold != settings.gateHold
+        || newSettings.gateRelease != settings.gateRelease)
+        updateReverbParameters (newSettings);
+    
+    if (force
+        || newSettings.duckThreshold != settings.duckThreshold
+        || newSettings.duckDepth != settings.duckDepth
+        || newSettings.duckAttack != settings.duckAttack
+        || newSettings.duckRelease != settings.duckRelease)
+        updateDucker (newSettings);
+    
+    settings = newSettings;
+}
+
+template <typename SampleType>
+void Engine<SampleType>::updateFilters (float newLowPassFreq, float newHighPassFreq) {
+    const auto resonance = static_cast<SampleType> (1 / std::sqrt (2.0));
+    
+    lowPassFilter.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
+    lowPassFilter.setResonance(resonance);
+    lowPassFilter.setCutoffFrequency(static_cast<SampleType> (newLowPassFreq));
+    
+    highPassFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
+    highPassFilter.setResonance(resonance);
+    highPassFilter.setCutoffFrequency(static_cast<SampleType> (newHighPassFreq));
+    
+    lowPassFreq = newLowPassFreq;
+    highPassFreq = newHighPassFreq;
+}
+
+template <typename SampleType>
+void Engine<SampleType>::updateReverbParameters (const Settings& newSettings) {
+    reverbParameters.roomSize = newSettings.size;
+    reverbParameters.damping = newSettings.damp;
+    reverbParameters.width = newSettings.width;
+    reverbParameters.wetLevel = newSettings.wetLevel;
+    reverbParameters.dryLevel = newSettings.dryLevel;
+    reverbParameters.freeze = newSettings.freeze;
+    reverbParameters.freezeMode = static_cast<FreezeMode> (newSettings.freezeMode);
+    reverbParameters.useDecayTime = newSettings.decayMode;
+    reverbParameters.decayTime = newSettings.decayTime;
+    reverbParameters.dampingFrequency = newSettings.dampFreq;
+    reverbParameters.lowDecay = newSettings.lowDecay;
+    reverbParameters.midDecay = newSettings.midDecay;
+    reverbParameters.highDecay = newSettings.highDecay;
+    reverbParameters.lowCrossover = newSettings.lowCrossover;
+    reverbParameters.highCrossover = newSettings.highCrossover;
+    reverbParameters.earlyLevel = newSettings.earlyLevel;
+    reverbParameters.gate = newSettings.gate;
+    reverbParameters.gateThreshold = newSettings.gateThreshold;
+    reverbParameters.gateHold = newSettings.gateHold;
+    reverbParameters.gateRelease = newSettings.gateRelease;
+    
+    reverb.setParameters(reverbParameters);
+}
+
+template <typename SampleType>
+void Engine<SampleType>::updateDucker (const Settings& newSettings)
+{
+    typename Ducker<SampleType>::Parameters duckerParameters;
+    duckerParameters.threshold = newSettings.duckThreshold;
+    duckerParameters.depth = newSettings.duckDepth;
+    duckerParameters.attack = newSettings.duckAttack;
+    duckerParameters.release = newSettings.duckRelease;
+    
+    ducker.setParameters (duckerParameters);
+}
+
+//==============================================================================
+template class Engine<float>;
+template class Engine<double>;
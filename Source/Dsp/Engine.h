@@ -0,0 +1,238 @@
+/*
+  ==============================================================================
+
+    Engine.h
+    Created: 19 Oct 2026 2:55:17pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "../Settings.h"
+#include "../Concurrency/ForkJoinPool.h"
+#include "../Concurrency/SpscRingBuffer.h"
+#include "Ducker.h"
+#include "MicroBlock.h"
+#include "Reverb.h"
+
+// The whole per-sample chain for one sample type. The processor owns one for each precision and
+// only prepares the one the host is actually using.
+template <typename SampleType>
+class Engine
+{
+public:
+    // Takes effect on the next prepare().
+    void setCoreMode (CoreMode newMode) noexcept { reverb.setCoreMode (newMode); }
+
+    // Audio thread, or before prepare(). The reflections move to the new room with a short fade.
+    void setReflectionTaps (const ReflectionTaps& taps) noexcept { reverb.setReflectionTaps (taps); }
+
+    void prepare (const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    // Applies a parameter snapshot. Coefficients are only recomputed for the parameters that moved.
+    void setSettings (const Settings& newSettings, bool force = false);
+
+    bool isSleeping() const noexcept { return reverb.isSleeping(); }
+
+    // Benchmarks only, see Reverb.
+    void setSleepEnabled (bool shouldSleep) noexcept { reverb.setSleepEnabled (shouldSleep); }
+    int countSubnormals() const noexcept { return reverb.countSubnormals(); }
+
+    // Reverb-only levels of the last process() call.
+    const BlockLevels& getWetLevels() const noexcept { return reverb.getWetLevels(); }
+
+    // Renders a host block in place. `key` is what ducks the wet signal, as long as the block and
+    // with at least one channel; it may be the block itself. `settingsAt (start)` is called at
+    // every micro-block boundary, with its offset into the block, and returns the snapshot that
+    // applies from there on. When a pool is passed, the left and right tanks run as two jobs on
+    // it. When a tap is passed, the mono wet signal is pushed into it (whatever doesn't fit is
+    // dropped).
+    template <typename SettingsCallback>
+    void process (const juce::dsp::AudioBlock<SampleType>& block, const juce::dsp::AudioBlock<const SampleType>& key,
+                  SettingsCallback&& settingsAt, ForkJoinPool* pool, SpscRingBuffer<float>* wetTap)
+    {
+        jassert (key.getNumSamples() == block.getNumSamples() && key.getNumChannels() > 0);
+
+        const auto numSamples = static_cast<int> (block.getNumSamples());
+        const auto numChannels = static_cast<int> (juce::jmin (block.getNumChannels(), static_cast<size_t> (2)));
+
+        reverb.clearWetLevels();
+        reverb.setWetTapEnabled (wetTap != nullptr);
+
+        if (numChannels == 0)
+            return;
+
+        for (int batchStart = 0; batchStart < numSamples;)
+        {
+            const auto batchLength = juce::jmin (numSamples - batchStart, reverb.getBatchCapacity());
+            const auto batch = block.getSubBlock (static_cast<size_t> (batchStart), static_cast<size_t> (batchLength));
+
+            reverb.beginBatch (numChannels);
+            numSlices = 0;
+
+            MicroBlock::forEach (batchLength, microBlockPhase, [&] (int start, int length, bool isBoundary)
+            {
+                if (isBoundary)
+                    setSettings (settingsAt (batchStart + start));
+
+                reverb.beginSlice (batch.getSubBlock (static_cast<size_t> (start), static_cast<size_t> (length)), start);
+
+                // The whole batch is read before any of it is overwritten, so the key can be the
+                // block itself.
+                const auto isDucked = ducker.isActive();
+
+                if (isDucked)
+                    ducker.process (key.getSubBlock (static_cast<size_t> (batchStart + start), static_cast<size_t> (length)),
+                                    duckGains.data() + start);
+
+                // The phase is only moved on after this returns, so it still says where the slice starts.
+                const auto endsMicroBlock = microBlockPhase + length == MicroBlock::size;
+
+                slices[static_cast<size_t> (numSlices++)] = { start, length, settings.lowPassFreq, settings.highPassFreq, isDucked, endsMicroBlock };
+            });
+
+            if (pool != nullptr && numChannels > 1)
+            {
+                auto processTank = [this] (int channel) { reverb.processTank (channel); };
+                pool->run (numChannels, processTank);
+            }
+            else
+            {
+                for (int channel = 0; channel < numChannels; ++channel)
+                    reverb.processTank (channel);
+            }
+
+            for (int i = 0; i < numSlices; ++i)
+            {
+                const auto& slice = slices[static_cast<size_t> (i)];
+                auto subBlock = batch.getSubBlock (static_cast<size_t> (slice.start), static_cast<size_t> (slice.length));
+
+                reverb.endSlice (subBlock, i, slice.isDucked ? duckGains.data() + slice.start : nullptr);
+
+                // The filters come after the tanks, so their settings are replayed per slice.
+                if (slice.lowPassFreq != lowPassFreq || slice.highPassFreq != highPassFreq)
+                    updateFilters (slice.lowPassFreq, slice.highPassFreq);
+
+                if (slice.length == MicroBlock::size)
+                    filterSlice (subBlock, MicroBlock::fullLength);
+                else
+                    filterSlice (subBlock, slice.length);
+
+                if (slice.endsMicroBlock)
+                {
+                    lowPassFilter.snapToZero();
+                    highPassFilter.snapToZero();
+                }
+            }
+
+            if (wetTap != nullptr)
+                pushToTap (*wetTap, reverb.getWetTap(), batchLength);
+
+            batchStart += batchLength;
+        }
+    }
+
+private:
+    static void pushToTap (SpscRingBuffer<float>& tap, const SampleType* samples, int numSamples) noexcept
+    {
+        if constexpr (std::is_same_v<SampleType, float>)
+        {
+            tap.push (samples, numSamples);
+        }
+        else
+        {
+            float converted[256];
+
+            for (int done = 0; done < numSamples;)
+            {
+                const auto count = juce::jmin (numSamples - done, static_cast<int> (std::size (converted)));
+
+                for (int i = 0; i < count; ++i)
+                    converted[i] = static_cast<float> (samples[done + i]);
+
+                if (tap.push (converted, count) < count)
+                    return;
+
+                done += count;
+            }
+        }
+    }
+
+    // Sample by sample, because process() snaps the state to zero at the end of every call, and a
+    // slice the host buffer cut short would snap it somewhere else. Snapping only where a
+    // micro-block ends keeps the output the same at every buffer size.
+    //
+    // Both filters are recursive, so nothing vectorises along the slice. A full micro-block has its
+    // length fixed at compile time, which unrolls the loop, and a stereo slice runs both channels
+    // in the same pass, which gives the compiler two independent recursions to interleave.
+    template <typename Length>
+    void filterSlice (const juce::dsp::AudioBlock<SampleType>& block, Length numSamples) noexcept
+    {
+        const auto filter = [this] (int channel, SampleType sample) noexcept
+        {
+            return highPassFilter.processSample (channel, lowPassFilter.processSample (channel, sample));
+        };
+
+        if (block.getNumChannels() == 2)
+        {
+            auto* left = block.getChannelPointer (0);
+            auto* right = block.getChannelPointer (1);
+
+            for (int n = 0; n < numSamples; ++n)
+            {
+                left[n] = filter (0, left[n]);
+                right[n] = filter (1, right[n]);
+            }
+
+            return;
+        }
+
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+        {
+            auto* samples = block.getChannelPointer (channel);
+
+            for (int n = 0; n < numSamples; ++n)
+                samples[n] = filter (static_cast<int> (channel), samples[n]);
+        }
+    }
+
+    void updateFilters (float newLowPassFreq, float newHighPassFreq);
+    void updateReverbParameters (const Settings& newSettings);
+    void updateDucker (const Settings& newSettings);
+
+    struct Slice
+    {
+        int start;
+        int length;
+        float lowPassFreq;
+        float highPassFreq;
+        bool isDucked;
+        bool endsMicroBlock;
+    };
+
+    Settings settings;
+
+    // Position inside the current micro-block, carried over from one host block to the next.
+    int microBlockPhase { 0 };
+
+    std::vector<Slice> slices;
+    int numSlices { 0 };
+
+    Reverb<SampleType> reverb;
+    typename Reverb<SampleType>::Parameters reverbParameters;
+
+    // Wet gains for the current batch, worked out in the first pass and applied in the last.
+    Ducker<SampleType> ducker;
+    std::vector<SampleType> duckGains;
+
+    // What the filters are currently set to, which trails `settings` by up to a batch.
+    float lowPassFreq { 0.0f };
+    float highPassFreq { 0.0f };
+
+    juce::dsp::StateVariableTPTFilter<SampleType> lowPassFilter;
+    juce::dsp::StateVariableTPTFilter<SampleType> highPassFilter;
+};
@@ -0,0 +1,191 @@
+/*
+  ==============================================================================
+
+    FreezeEngine.cpp
+    Created: 19 Oct 2026 11:26:08am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "FreezeEngine.h"
+
+template <typename SampleType>
+void FreezeEngine<SampleType>::prepare (double sampleRate)
+{
+    loopLength = static_cast<int> (sampleRate * loopSeconds);
+    const auto fadeLength = static_cast<int> (sampleRate * loopFadeSeconds);
+
+    // The history holds one loop plus the tail that gets folded back over the loop point.
+    for (auto& h : history)
+        h.assign (static_cast<size_t> (loopLength + fadeLength), SampleType (0));
+
+    // Depends on nothing but its length, so instances at the same rate share it.
+    loopFade = TableCache::get<std::vector<SampleType>> ("freeze loop fade " + juce::String (fadeLength), [fadeLength]
+    {
+        std::vector<SampleType> fade (static_cast<size_t> (fadeLength));
+
+        for (size_t i = 0; i < fade.size(); ++i)
+            fade[i] = std::sin (juce::MathConstants<SampleType>::halfPi * static_cast<SampleType> (i) / static_cast<SampleType> (fadeLength));
+
+        return fade;
+    });
+
+    transitionStep = static_cast<float> (1.0 / (sampleRate * transitionSeconds));
+
+    reset();
+}
+
+template <typename SampleType>
+void FreezeEngine<SampleType>::reset()
+{
+    for (auto& h : history)
+        std::fill (h.begin(), h.end(), SampleType (0));
+
+    writeIndex = 0;
+    captureStart = 0;
+    loopPosition = 0;
+    playing = looping;
+    pendingCapture = false;
+    transition = looping ? 1.0f : 0.0f;
+}
+
+template <typename SampleType>
+void FreezeEngine<SampleType>::setLooping (bool shouldLoop, bool keepTankLive) noexcept
+{
+    keepLive = keepTankLive;
+
+    if (shouldLoop == looping)
+        return;
+
+    looping = shouldLoop;
+
+    // Capture whatever the history holds when the next slice starts. If the previous loop is still
+    // fading out it simply fades back in, since nothing has been recorded over it yet.
+    if (looping && ! playing)
+    {
+        pendingCapture = true;
+        playing = true;
+    }
+}
+
+template <typename SampleType>
+typename FreezeEngine<SampleType>::Slice FreezeEngine<SampleType>::advance (SampleType* tankGains, SampleType* loopGains, int numSamples) noexcept
+{
+    Slice slice;
+    slice.capture = std::exchange (pendingCapture, false);
+    slice.playing = playing;
+    slice.skipTank = playing && ! keepLive && looping && transition >= 1.0f;
+
+    if (! playing)
+        return slice;
+
+    const auto target = looping ? 1.0f : 0.0f;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        auto tankGain = SampleType (1);
+        auto loopGain = SampleType (1);
+
+        if (transition != target)
+        {
+            transition = looping ? juce::jmin (1.0f, transition + transitionStep)
+                                 : juce::jmax (0.0f, transition - transitionStep);
+
+            const auto angle = juce::MathConstants<SampleType>::halfPi * static_cast<SampleType> (transition);
+            tankGain = keepLive ? SampleType (1) : std::cos (angle);
+            loopGain = std::sin (angle);
+        }
+        else if (! keepLive)
+        {
+            tankGain = static_cast<SampleType> (1.0f - transition);
+            loopGain = static_cast<SampleType> (transition);
+        }
+        else
+        {
+            loopGain = static_cast<SampleType> (transition);
+        }
+
+        tankGains[i] = tankGain;
+        loopGains[i] = loopGain;
+    }
+
+    if (! looping && transition <= 0.0f)
+        playing = false;
+
+    return slice;
+}
+
+template <typename SampleType>
+void FreezeEngine<SampleType>::process (const Slice& slice, SampleType* left, SampleType* right,
+                                        const SampleType* tankGains, const SampleType* loopGains, int numSamples) noexcept
+{
+    if (slice.capture)
+    {
+        captureStart = writeIndex;
+        loopPosition = 0;
+    }
+
+    if (! slice.playing)
+    {
+        record (left, right, numSamples);
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        left[i] = left[i] * tankGains[i] + readLoop (history[0]) * loopGains[i];
+
+        if (right != nullptr)
+            right[i] = right[i] * tankGains[i] + readLoop (history[1]) * loopGains[i];
+
+        if (++loopPosition == loopLength)
+            loopPosition = 0;
+    }
+}
+
+template <typename SampleType>
+void FreezeEngine<SampleType>::record (const SampleType* left, const SampleType* right, int numSamples) noexcept
+{
+    const auto capacity = static_cast<int> (history[0].size());
+
+    for (int done = 0; done < numSamples;)
+    {
+        const auto run = juce::jmin (numSamples - done, capacity - writeIndex);
+
+        std::copy (left + done, left + done + run, history[0].data() + writeIndex);
+        std::copy (right != nullptr ? right + done : left + done,
+                   (right != nullptr ? right : left) + done + run,
+                   history[1].data() + writeIndex);
+
+        done += run;
+        writeIndex += run;
+
+        if (writeIndex == capacity)
+            writeIndex = 0;
+    }
+}
+
+template <typename SampleType>
+SampleType FreezeEngine<SampleType>::readLoop (const std::vector<SampleType>& h) const noexcept
+{
+    const auto capacity = static_cast<int> (h.size());
+    const auto sample = h[static_cast<size_t> ((captureStart + loopPosition) % capacity)];
+    const auto& fade = *loopFade;
+    const auto fadeLength = static_cast<int> (fade.size());
+
+    if (loopPosition >= fadeLength)
+        return sample;
+
+    // The start of the loop is crossfaded with what was recorded just after its end, so wrapping
+    // from the last sample back to the first is continuous.
+    const auto overlap = h[static_cast<size_t> ((captureStart + loopLength + loopPosition) % capacity)];
+    const auto fadeIn = fade[static_cast<size_t> (loopPosition)];
+    const auto fadeOut = fade[static_cast<size_t> (fadeLength - 1 - loopPosition)];
+
+    return sample * fadeIn + overlap * fadeOut;
+}
+
+//==============================================================================
+template class FreezeEngine<float>;
+template class FreezeEngine<double>;
@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    FreezeEngine.h
+    Created: 19 Oct 2026 11:26:08am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "TableCache.h"
+
+enum class FreezeMode
+{
+    hold,           // freeze the comb feedback, as juce::dsp::Reverb does
+    loop,           // replace the tank with a captured loop, the tank stops running
+    loopWithLive    // play the captured loop and keep the tank running on new input
+};
+
+// Keeps a short history of the tank output and, when a looping freeze is engaged, plays it back
+// as a seamless loop instead of (or on top of) the live tank.
+//
+// The crossfade is decided before the tank runs (advance) and applied to its output afterwards
+// (process), so a whole batch of slices can be advanced first and have its tanks computed in one
+// go. Both calls have to be made once per slice, in the same order.
+template <typename SampleType>
+class FreezeEngine
+{
+public:
+    // What advance() decided for a slice, to be handed back to process() for the same slice.
+    struct Slice
+    {
+        bool skipTank { false };    // the tank output is thrown away, so it needn't be computed
+        bool capture { false };     // a new loop starts at the beginning of this slice
+        bool playing { false };     // false while the tank is only being recorded
+    };
+
+    void prepare (double sampleRate);
+    void reset();
+
+    void setLooping (bool shouldLoop, bool keepTankLive) noexcept;
+
+    // Moves the crossfade on by a slice and writes the per-sample tank and loop gains for it.
+    Slice advance (SampleType* tankGains, SampleType* loopGains, int numSamples) noexcept;
+
+    // Records the tank output for this slice, or crossfades it with the loop. `right` may be null.
+    void process (const Slice& slice, SampleType* left, SampleType* right,
+                  const SampleType* tankGains, const SampleType* loopGains, int numSamples) noexcept;
+
+private:
+    void record (const SampleType* left, const SampleType* right, int numSamples) noexcept;
+    SampleType readLoop (const std::vector<SampleType>& history) const noexcept;
+
+    static constexpr double loopSeconds { 1.5 };
+    static constexpr double loopFadeSeconds { 0.25 };
+    static constexpr double transitionSeconds { 0.05 };
+
+    // Audio side, only touched by process().
+    std::vector<SampleType> history[2];
+    TableCache::Pointer<std::vector<SampleType>> loopFade;
+    int loopLength { 0 };
+    int writeIndex { 0 };
+
+    int captureStart { 0 };
+    int loopPosition { 0 };
+
+    // Control side, only touched by setLooping() and advance().
+    bool playing { false };
+    bool looping { false };
+    bool keepLive { false };
+    bool pendingCapture { false };
+
+    // 0 is the live tank only, 1 is the loop only. Gains follow an equal-power curve.
+    float transition { 0.0f };
+    float transitionStep { 0.0f };
+};
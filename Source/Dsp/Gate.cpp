@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+
+    Gate.cpp
+    Created: 19 Oct 2026 11:41:17pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Gate.h"
+
+template <typename SampleType>
+void Gate<SampleType>::prepare (double newSampleRate)
+{
+    sampleRate = newSampleRate;
+
+    // The times may have been set before the rate was known.
+    setParameters (parameters);
+    reset();
+}
+
+template <typename SampleType>
+void Gate<SampleType>::reset() noexcept
+{
+    // Starts open, as if the last hit had only just happened, so switching the gate on never
+    // cuts off a tail that is already ringing.
+    holdCounter = holdSamples;
+    gain = SampleType (1);
+}
+
+template <typename SampleType>
+void Gate<SampleType>::setParameters (const Parameters& newParams) noexcept
+{
+    const auto wasEnabled = parameters.enabled;
+
+    parameters = newParams;
+    thresholdGain = juce::Decibels::decibelsToGain (static_cast<SampleType> (newParams.threshold));
+    holdSamples = juce::roundToInt (juce::jmax (0.0f, newParams.hold) * 0.001 * sampleRate);
+
+    auto stepFor = [this] (double seconds)
+    {
+        return static_cast<SampleType> (1.0 / juce::jmax (1.0, seconds * sampleRate));
+    };
+
+    attackStep = stepFor (attackSeconds);
+    releaseStep = stepFor (juce::jmax (0.0f, newParams.release) * 0.001);
+
+    if (newParams.enabled && ! wasEnabled)
+        reset();
+}
+
+//==============================================================================
+template class Gate<float>;
+template class Gate<double>;
@@ -0,0 +1,84 @@
+/*
+  ==============================================================================
+
+    Gate.h
+    Created: 19 Oct 2026 11:41:17pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "MicroBlock.h"
+#include "PeakDetector.h"
+
+// The gate of a gated reverb. It opens as soon as the key goes over the threshold, stays open
+// for the hold time after the key last did, then closes over the release time.
+//
+// The gain computer is free of branches: the comparisons come out as 0 or 1 and select between
+// values by multiplying, and the ramps are clamped with min and max, so a burst of transients
+// costs exactly what silence does.
+template <typename SampleType>
+class Gate
+{
+public:
+    struct Parameters
+    {
+        bool enabled { false };
+        float threshold { -30.0f };     // dB
+        float hold { 250.0f };          // ms
+        float release { 80.0f };        // ms
+    };
+
+    void prepare (double sampleRate);
+    void reset() noexcept;
+
+    void setParameters (const Parameters& newParams) noexcept;
+
+    // While this is false process() doesn't have to be called and the wet signal is left alone.
+    bool isEnabled() const noexcept { return parameters.enabled; }
+
+    // Writes the wet gains for a slice of at most MicroBlock::size samples of the key. Returns
+    // true when the gate stayed fully closed throughout.
+    bool process (const juce::dsp::AudioBlock<const SampleType>& key, SampleType* gains) noexcept
+    {
+        const auto n = static_cast<int> (key.getNumSamples());
+
+        alignas (16) SampleType peak[MicroBlock::size];
+        PeakDetector::acrossChannels (key, peak);
+
+        auto loudest = SampleType (0);
+
+        for (int i = 0; i < n; ++i)
+        {
+            const auto isAbove = static_cast<int> (peak[i] > thresholdGain);
+            holdCounter = isAbove * holdSamples + (1 - isAbove) * juce::jmax (holdCounter - 1, 0);
+
+            // Open ramps up by the attack step, closed ramps down by the release step.
+            const auto isOpen = static_cast<SampleType> (holdCounter > 0);
+            gain = juce::jlimit (SampleType (0), SampleType (1), gain + isOpen * (attackStep + releaseStep) - releaseStep);
+
+            gains[i] = gain;
+            loudest = juce::jmax (loudest, gain);
+        }
+
+        return loudest == SampleType (0);
+    }
+
+private:
+    // Fast enough to keep the hit, slow enough not to click.
+    static constexpr double attackSeconds { 0.001 };
+
+    double sampleRate { 44100.0 };
+    Parameters parameters;
+
+    SampleType thresholdGain { 1 };
+    SampleType attackStep { 1 };
+    SampleType releaseStep { 1 };
+    int holdSamples { 0 };
+
+    int holdCounter { 0 };
+    SampleType gain { 0 };
+};
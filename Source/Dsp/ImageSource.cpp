@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+
+    ImageSource.cpp
+    Created: 19 Oct 2026 11:02:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "ImageSource.h"
+#include <numeric>
+
+namespace
+{
+    constexpr double speedOfSound { 343.0 };
+    constexpr double earHeight { 1.5 };
+
+    // Closer than this the direct sound would dwarf every reflection.
+    constexpr double minDirectDistance { 0.5 };
+
+    // Where the source shows up along one axis of length `size` after `reflections` bounces off
+    // its two walls: the source itself, its mirror in either wall, or a mirror of those.
+    struct AxisImage
+    {
+        double position;
+        int reflections;
+    };
+
+    std::array<AxisImage, 5> axisImages (double source, double size)
+    {
+        return { { { source, 0 },
+                   { -source, 1 },
+                   { 2.0 * size - source, 1 },
+                   { source - 2.0 * size, 2 },
+                   { source + 2.0 * size, 2 } } };
+    }
+}
+
+ReflectionTaps computeImageSources (const RoomGeometry& room)
+{
+    // Keep both ends a little way off the walls so no image lands on top of the listener.
+    auto inside = [] (float proportion, float size)
+    {
+        return static_cast<double> (juce::jlimit (0.02f, 0.98f, proportion) * size);
+    };
+
+    const auto height = juce::jmin (earHeight, 0.5 * room.height);
+    const double source[] { inside (room.sourceX, room.width), inside (room.sourceY, room.depth), height };
+    const double listener[] { inside (room.listenerX, room.width), inside (room.listenerY, room.depth), height };
+    const double sizes[] { room.width, room.depth, room.height };
+
+    const auto direct = juce::jmax (minDirectDistance, std::hypot (source[0] - listener[0], source[1] - listener[1]));
+    const auto reflectionGain = std::sqrt (1.0 - juce::jlimit (0.0, 1.0, static_cast<double> (room.absorption)));
+
+    const auto x = axisImages (source[0], sizes[0]);
+    const auto y = axisImages (source[1], sizes[1]);
+    const auto z = axisImages (source[2], sizes[2]);
+
+    ReflectionTaps taps;
+
+    for (const auto& ix : x)
+    {
+        for (const auto& iy : y)
+        {
+            for (const auto& iz : z)
+            {
+                const auto reflections = ix.reflections + iy.reflections + iz.reflections;
+
+                // No reflections is the direct sound.
+                if (reflections == 0 || reflections > 2)
+                    continue;
+
+                const auto dx = ix.position - listener[0];
+                const auto dy = iy.position - listener[1];
+                const auto dz = iz.position - listener[2];
+                const auto distance = std::sqrt (dx * dx + dy * dy + dz * dz);
+
+                // Equal-power pan by the lateral part of the direction it arrives from.
+                const auto pan = juce::jlimit (-1.0, 1.0, dx / distance);
+                const auto gain = std::pow (reflectionGain, reflections) * direct / distance;
+
+                auto& i = taps.numTaps;
+                jassert (i < ReflectionTaps::maxTaps);
+
+                taps.delaySeconds[i] = static_cast<float> (juce::jlimit (0.0, ReflectionTaps::maxDelaySeconds, (distance - direct) / speedOfSound));
+                taps.leftGains[i] = static_cast<float> (gain * std::sqrt (0.5 * (1.0 - pan)));
+                taps.rightGains[i] = static_cast<float> (gain * std::sqrt (0.5 * (1.0 + pan)));
+                ++i;
+            }
+        }
+    }
+
+    // In delay order the renderer reads neighbouring stretches of its delay line one after the other.
+    std::array<int, ReflectionTaps::maxTaps> order;
+    std::iota (order.begin(), order.begin() + taps.numTaps, 0);
+    std::sort (order.begin(), order.begin() + taps.numTaps, [&taps] (int a, int b) { return taps.delaySeconds[a] < taps.delaySeconds[b]; });
+
+    ReflectionTaps sorted;
+    sorted.numTaps = taps.numTaps;
+    auto energy = 0.0;
+
+    for (int i = 0; i < taps.numTaps; ++i)
+    {
+        const auto from = order[static_cast<size_t> (i)];
+        sorted.delaySeconds[i] = taps.delaySeconds[from];
+        sorted.leftGains[i] = taps.leftGains[from];
+        sorted.rightGains[i] = taps.rightGains[from];
+
+        const auto sum = static_cast<double> (sorted.leftGains[i] + sorted.rightGains[i]);
+        energy += sum * sum;
+    }
+
+    sorted.tailGain = energy > 0.0 ? static_cast<float> (1.0 / std::sqrt (energy)) : 0.0f;
+
+    return sorted;
+}
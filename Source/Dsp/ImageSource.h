@@ -0,0 +1,54 @@
+/*
+  ==============================================================================
+
+    ImageSource.h
+    Created: 19 Oct 2026 11:02:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+// A shoebox room with one source and one listener, both at ear height. Positions are proportions
+// of the width (left to right) and depth (back to front), so they stay inside the room as it is
+// resized.
+struct RoomGeometry
+{
+    float width { 8.0f };           // metres
+    float depth { 12.0f };
+    float height { 3.5f };
+    float sourceX { 0.35f };
+    float sourceY { 0.7f };
+    float listenerX { 0.5f };
+    float listenerY { 0.25f };
+    float absorption { 0.3f };      // energy lost at each wall, the same for all of them
+};
+
+// One tap per image source, sorted by delay. The delays are counted from the direct sound, which
+// the dry signal already carries, and the gains are relative to it.
+struct ReflectionTaps
+{
+    // Every first- and second-order image: 6 single reflections, 6 double ones off the same
+    // pair of walls and 12 off two different pairs.
+    static constexpr int maxTaps { 24 };
+
+    // Longest delay the largest room can produce, for sizing delay lines.
+    static constexpr double maxDelaySeconds { 0.3 };
+
+    int numTaps { 0 };
+    float delaySeconds[maxTaps] {};
+    float leftGains[maxTaps] {};
+    float rightGains[maxTaps] {};
+
+    // Brings the sum of both channels back to the energy of the direct sound, for feeding the tail.
+    float tailGain { 0.0f };
+};
+
+// Mirrors the source in the walls up to two reflections deep. Each image falls off with its
+// distance (relative to the direct path) and with every wall it bounced off, and is panned by how
+// far it lies to the left or right of a listener facing the front wall. Meant to run off the
+// audio thread, once per change of the room.
+ReflectionTaps computeImageSources (const RoomGeometry& room);
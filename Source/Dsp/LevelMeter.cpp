@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+
+    LevelMeter.cpp
+    Created: 19 Oct 2026 4:05:19pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "LevelMeter.h"
+
+void LevelMeter::prepare (double sampleRate)
+{
+    constexpr double peakFallDecibelsPerSecond { 24.0 };
+    constexpr double rmsTimeConstantSeconds { 0.3 };
+
+    peakFallPerSample = -peakFallDecibelsPerSecond / 20.0 * std::log (10.0) / sampleRate;
+    rmsDecayPerSample = -1.0 / (rmsTimeConstantSeconds * sampleRate);
+
+    reset();
+}
+
+void LevelMeter::reset() noexcept
+{
+    meanSquare[0] = meanSquare[1] = 0.0f;
+    reading = {};
+}
+
+void LevelMeter::update (const BlockLevels& levels) noexcept
+{
+    if (levels.numSamples == 0)
+        return;
+
+    const auto peakFall = static_cast<float> (std::exp (peakFallPerSample * levels.numSamples));
+    const auto rmsDecay = static_cast<float> (std::exp (rmsDecayPerSample * levels.numSamples));
+
+    reading.numChannels = levels.numChannels;
+
+    for (int channel = 0; channel < levels.numChannels; ++channel)
+    {
+        auto& peak = reading.peak[channel];
+        peak = juce::jmax (levels.peak[channel], peak * peakFall);
+
+        const auto blockMeanSquare = static_cast<float> (levels.sumOfSquares[channel] / levels.numSamples);
+        auto& ms = meanSquare[channel];
+        ms = blockMeanSquare + (ms - blockMeanSquare) * rmsDecay;
+
+        // -120 dB, anything below is shown as silence anyway.
+        if (peak < 1.0e-6f)
+            peak = 0.0f;
+
+        if (ms < 1.0e-12f)
+            ms = 0.0f;
+
+        reading.rms[channel] = std::sqrt (ms);
+    }
+}
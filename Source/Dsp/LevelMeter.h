@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+
+    LevelMeter.h
+    Created: 19 Oct 2026 4:05:19pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "../Telemetry.h"
+
+// Raw peak and energy of up to two channels over a stretch of audio. It is filled on the audio
+// thread, a host block or a micro-block at a time, and then folded into a LevelMeter.
+struct BlockLevels
+{
+    float peak[2] {};
+    double sumOfSquares[2] {};
+    int numChannels { 0 };
+    int numSamples { 0 };
+
+    void clear() noexcept { *this = {}; }
+
+    template <typename SampleType>
+    void add (const SampleType* const* channels, int channelCount, int count) noexcept
+    {
+        numChannels = juce::jmin (channelCount, 2);
+
+        if (count <= 0)
+            return;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const auto range = juce::FloatVectorOperations::findMinAndMax (channels[channel], count);
+            peak[channel] = juce::jmax (peak[channel], static_cast<float> (juce::jmax (-range.getStart(), range.getEnd())));
+            sumOfSquares[channel] += static_cast<double> (sumOfSquaresOf (channels[channel], count));
+        }
+
+        numSamples += count;
+    }
+
+private:
+    // JUCE's vector ops have no reduction for this, so it uses SIMDRegister directly on the
+    // aligned part of the run.
+    template <typename SampleType>
+    static SampleType sumOfSquaresOf (const SampleType* samples, int count) noexcept
+    {
+        using Register = juce::dsp::SIMDRegister<SampleType>;
+        constexpr auto width = static_cast<int> (Register::SIMDNumElements);
+
+        auto sum = SampleType (0);
+        int i = 0;
+
+        for (; i < count && ! Register::isSIMDAligned (samples + i); ++i)
+            sum += samples[i] * samples[i];
+
+        auto accumulator = Register::expand (SampleType (0));
+
+        for (; i + width <= count; i += width)
+        {
+            const auto v = Register::fromRawArray (samples + i);
+            accumulator += v * v;
+        }
+
+        sum += accumulator.sum();
+
+        for (; i < count; ++i)
+            sum += samples[i] * samples[i];
+
+        return sum;
+    }
+};
+
+// Peak-hold and RMS ballistics, run on the audio thread once per host block.
+class LevelMeter
+{
+public:
+    void prepare (double sampleRate);
+    void reset() noexcept;
+
+    void update (const BlockLevels& levels) noexcept;
+
+    const MeterReading& getReading() const noexcept { return reading; }
+
+private:
+    // Natural-log decay per sample, so a block of any length costs one exp() per meter.
+    double peakFallPerSample { 0.0 };
+    double rmsDecayPerSample { 0.0 };
+
+    float meanSquare[2] {};
+    MeterReading reading;
+};
@@ -0,0 +1,40 @@
+/*
+  ==============================================================================
+
+    MicroBlock.h
+    Created: 19 Oct 2026 9:04:12am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <type_traits>
+
+namespace MicroBlock
+{
+// Internal processing length. Parameter snapshots and coefficient updates only happen on these
+// boundaries, counted from the last reset, so the output doesn't depend on the host's buffer size.
+inline constexpr int size { 32 };
+
+// Length tag for a full micro-block, lets the kernels unroll their loops at compile time.
+using FullLength = std::integral_constant<int, size>;
+inline constexpr FullLength fullLength {};
+
+// Slices [0, numSamples) on micro-block boundaries and calls back with (start, length, isBoundary).
+// `phase` is the position inside the current micro-block and carries over to the next host buffer.
+template <typename Callback>
+void forEach (int numSamples, int& phase, Callback&& callback)
+{
+    for (int start = 0; start < numSamples;)
+    {
+        const auto length = juce::jmin (size - phase, numSamples - start);
+        callback (start, length, phase == 0);
+
+        start += length;
+        phase = (phase + length) % size;
+    }
+}
+}
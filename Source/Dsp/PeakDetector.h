@@ -0,0 +1,36 @@
+/*
+  ==============================================================================
+
+    PeakDetector.h
+    Created: 19 Oct 2026 11:41:17pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "MicroBlock.h"
+
+namespace PeakDetector
+{
+// Writes the largest magnitude across the channels of a slice, sample by sample, for the key of a
+// dynamics stage. Two vector ops per channel, whatever the channel count.
+template <typename SampleType>
+void acrossChannels (const juce::dsp::AudioBlock<const SampleType>& block, SampleType* dest) noexcept
+{
+    const auto n = static_cast<int> (block.getNumSamples());
+    jassert (n <= MicroBlock::size && block.getNumChannels() > 0);
+
+    juce::FloatVectorOperations::abs (dest, block.getChannelPointer (0), n);
+
+    alignas (16) SampleType rectified[MicroBlock::size];
+
+    for (size_t channel = 1; channel < block.getNumChannels(); ++channel)
+    {
+        juce::FloatVectorOperations::abs (rectified, block.getChannelPointer (channel), n);
+        juce::FloatVectorOperations::max (dest, dest, rectified, n);
+    }
+}
+}
@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    Resampler.cpp
+    Created: 19 Oct 2026 7:41:55pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Resampler.h"
+
+std::vector<double> HalfBand::designSideTaps()
+{
+    // Windowed sinc at a quarter of the higher rate. Every second tap lands on a zero of the sinc.
+    std::vector<double> taps (static_cast<size_t> (numSideTaps));
+
+    for (int k = 0; k < numSideTaps; ++k)
+    {
+        const auto x = 2 * k + 1;
+        const auto sinc = std::sin (juce::MathConstants<double>::halfPi * x) / (juce::MathConstants<double>::pi * x);
+
+        const auto w = juce::MathConstants<double>::twoPi * (centre + x) / (numTaps - 1);
+        const auto blackman = 0.42 - 0.5 * std::cos (w) + 0.08 * std::cos (2.0 * w);
+
+        taps[static_cast<size_t> (k)] = sinc * blackman;
+    }
+
+    // Normalised for exactly unity gain at DC.
+    auto sum = 0.0;
+
+    for (auto t : taps)
+        sum += 2.0 * t;
+
+    for (auto& t : taps)
+        t *= 0.5 / sum;
+
+    return taps;
+}
+
+namespace
+{
+    int getNumStages (int factor)
+    {
+        jassert (juce::isPowerOfTwo (factor) && factor > 1);
+
+        auto numStages = 0;
+
+        while ((1 << numStages) < factor)
+            ++numStages;
+
+        return numStages;
+    }
+
+    // Every decimator and interpolator of a sample type shares the one set.
+    template <typename SampleType>
+    TableCache::Pointer<std::vector<SampleType>> getSideTaps()
+    {
+        return TableCache::get<std::vector<SampleType>> ("half-band side taps", []
+        {
+            const auto design = HalfBand::designSideTaps();
+            return std::vector<SampleType> (design.begin(), design.end());
+        });
+    }
+}
+
+//==============================================================================
+template <typename SampleType>
+void HalfBandDecimator<SampleType>::prepare (int factor)
+{
+    stages.resize (static_cast<size_t> (getNumStages (factor)));
+    sideTaps = getSideTaps<SampleType>();
+
+    reset();
+}
+
+template <typename SampleType>
+void HalfBandDecimator<SampleType>::reset() noexcept
+{
+    for (auto& stage : stages)
+        stage = {};
+}
+
+//==============================================================================
+template <typename SampleType>
+void HalfBandInterpolator<SampleType>::prepare (int factor, int maxBlockSize)
+{
+    const auto numStages = getNumStages (factor);
+    jassert (numStages <= maxStages);
+
+    stages.resize (static_cast<size_t> (numStages));
+    sideTaps = getSideTaps<SampleType>();
+
+    // The stage nearest the host writes straight to the output, the others alternate between these.
+    for (auto& w : work)
+        w.resize (static_cast<size_t> (maxBlockSize / 2 + 1));
+
+    reset();
+}
+
+template <typename SampleType>
+void HalfBandInterpolator<SampleType>::reset() noexcept
+{
+    for (auto& stage : stages)
+        stage = {};
+}
+
+//==============================================================================
+template class HalfBandDecimator<float>;
+template class HalfBandDecimator<double>;
+template class HalfBandInterpolator<float>;
+template class HalfBandInterpolator<double>;
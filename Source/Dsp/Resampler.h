@@ -0,0 +1,190 @@
+/*
+  ==============================================================================
+
+    Resampler.h
+    Created: 19 Oct 2026 7:41:55pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <vector>
+#include "MicroBlock.h"
+#include "TableCache.h"
+
+// Power-of-two resampling for running the tank at a fraction of the host rate, built from cascaded
+// half-band FIR stages. In polyphase form every other tap of a half-band filter is zero and the rest
+// are symmetric, so each stage costs about a quarter of a plain FIR of the same length, and the
+// stages after the first run at ever lower rates.
+//
+// Each stage keeps its own phase. A stage emits (or, interpolating, takes) a sample on every second
+// sample at its higher rate, so a decimator and an interpolator prepared together line up: the
+// interpolator takes each sample on the same host sample the decimator emitted it on. That lets a
+// block be decimated in one pass and interpolated in a later one with no extra buffering.
+namespace HalfBand
+{
+    // 47 taps with a Blackman window: about 74 dB of stopband, and after all stages the passband
+    // reaches 0.38 of the lower rate, 18 kHz at 48 kHz.
+    inline constexpr int numSideTaps { 12 };
+    inline constexpr int numTaps { 4 * numSideTaps - 1 };
+    inline constexpr int centre { numTaps / 2 };
+
+    // The non-zero taps either side of the centre, nearest first. The centre tap is 0.5.
+    std::vector<double> designSideTaps();
+}
+
+template <typename SampleType>
+class HalfBandDecimator
+{
+public:
+    void prepare (int factor);
+    void reset() noexcept;
+
+    // Consumes `numSamples` inputs, at most a micro-block, and returns how many outputs that completed.
+    int process (const SampleType* input, int numSamples, SampleType* output) noexcept
+    {
+        jassert (numSamples <= MicroBlock::size);
+
+        auto numOutputs = numSamples;
+        const auto* stageInput = input;
+
+        for (size_t s = 0; s < stages.size(); ++s)
+        {
+            auto* stageOutput = s + 1 == stages.size() ? output : work[s & 1];
+            numOutputs = stages[s].process (stageInput, numOutputs, stageOutput, sideTaps->data());
+            stageInput = stageOutput;
+        }
+
+        return numOutputs;
+    }
+
+private:
+    struct Stage
+    {
+        int process (const SampleType* input, int numSamples, SampleType* output, const SampleType* sideTaps) noexcept
+        {
+            auto numOutputs = 0;
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                // The history is kept twice over so the newest numTaps samples are always contiguous.
+                position = (position == 0 ? HalfBand::numTaps : position) - 1;
+                history[position] = history[position + HalfBand::numTaps] = input[i];
+
+                oddSample = ! oddSample;
+
+                if (! oddSample)
+                    output[numOutputs++] = filter (history + position, sideTaps);
+            }
+
+            return numOutputs;
+        }
+
+        static SampleType filter (const SampleType* window, const SampleType* sideTaps) noexcept
+        {
+            auto sum = SampleType (0.5) * window[HalfBand::centre];
+
+            for (int k = 0; k < HalfBand::numSideTaps; ++k)
+                sum += sideTaps[k] * (window[HalfBand::centre - 2 * k - 1] + window[HalfBand::centre + 2 * k + 1]);
+
+            return sum;
+        }
+
+        SampleType history[2 * HalfBand::numTaps] {};
+        int position { 0 };
+        bool oddSample { false };
+    };
+
+    std::vector<Stage> stages;
+    TableCache::Pointer<std::vector<SampleType>> sideTaps;
+
+    // Between stages.
+    SampleType work[2][MicroBlock::size] {};
+};
+
+template <typename SampleType>
+class HalfBandInterpolator
+{
+public:
+    // `maxBlockSize` is the most host samples a single process() call will be asked for.
+    void prepare (int factor, int maxBlockSize);
+    void reset() noexcept;
+
+    // Writes `numSamples` outputs and returns how many inputs were consumed.
+    int process (const SampleType* input, SampleType* output, int numSamples) noexcept
+    {
+        // The counts follow from each stage's phase, so the stages can run one after another from
+        // the lowest rate up.
+        const auto numStages = static_cast<int> (stages.size());
+        int numOutputs[maxStages + 1];
+        numOutputs[0] = numSamples;
+
+        for (int s = 0; s < numStages; ++s)
+            numOutputs[s + 1] = stages[static_cast<size_t> (s)].getNumInputsNeeded (numOutputs[s]);
+
+        const auto* stageInput = input;
+
+        for (int s = numStages; --s >= 0;)
+        {
+            auto* stageOutput = s == 0 ? output : work[static_cast<size_t> (s & 1)].data();
+            stages[static_cast<size_t> (s)].process (stageInput, stageOutput, numOutputs[s], sideTaps->data());
+            stageInput = stageOutput;
+        }
+
+        return numOutputs[numStages];
+    }
+
+private:
+    static constexpr int maxStages { 3 };
+
+    struct Stage
+    {
+        int getNumInputsNeeded (int numOutputs) const noexcept
+        {
+            return delayPhaseIsNext ? numOutputs / 2 : (numOutputs + 1) / 2;
+        }
+
+        void process (const SampleType* input, SampleType* output, int numOutputs, const SampleType* sideTaps) noexcept
+        {
+            for (int i = 0; i < numOutputs; ++i)
+            {
+                // One phase of the upsampled filter is just the centre tap, i.e. a delay.
+                if (delayPhaseIsNext)
+                {
+                    output[i] = history[position + HalfBand::numSideTaps - 1];
+                    delayPhaseIsNext = false;
+                    continue;
+                }
+
+                position = (position == 0 ? historyLength : position) - 1;
+                history[position] = history[position + historyLength] = *input++;
+
+                const auto* window = history + position;
+                auto sum = SampleType (0);
+
+                for (int k = 0; k < HalfBand::numSideTaps; ++k)
+                    sum += sideTaps[k] * (window[HalfBand::numSideTaps - 1 - k] + window[HalfBand::numSideTaps + k]);
+
+                // Doubled, to make up for the zeros that upsampling stuffs in.
+                output[i] = SampleType (2) * sum;
+                delayPhaseIsNext = true;
+            }
+        }
+
+        static constexpr int historyLength { 2 * HalfBand::numSideTaps };
+
+        SampleType history[2 * historyLength] {};
+        int position { 0 };
+
+        // Starts out true so that the first input is taken on the same host sample the decimator
+        // would emit it.
+        bool delayPhaseIsNext { true };
+    };
+
+    std::vector<Stage> stages;
+    TableCache::Pointer<std::vector<SampleType>> sideTaps;
+    std::vector<SampleType> work[2];
+};
@@ -0,0 +1,367 @@
+/*
+  ==============================================================================
+
+    Reverb.cpp
+    Created: 19 Oct 2026 9:12:40am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Reverb.h"
+
+template <typename SampleType>
+void Reverb<SampleType>::prepare (const juce::dsp::ProcessSpec& spec)
+{
+    jassert (spec.numChannels <= 2);
+
+    // The reduced rate halves the host rate for as long as it stays at 44.1 or 48 kHz or above,
+    // so 96 and 192 kHz sessions get a 48 kHz tank and 88.2 and 176.4 kHz ones a 44.1 kHz tank.
+    rateFactor = 1;
+
+    if (coreMode == CoreMode::reducedRate)
+        while (rateFactor < maxRateFactor && spec.sampleRate / (rateFactor * 2) >= Tunings::referenceSampleRate)
+            rateFactor *= 2;
+
+    coreRate = spec.sampleRate / rateFactor;
+
+    // Tunings are the original Freeverb ones at 44.1 kHz, scaled to the tank's rate. The classic
+    // mode truncates them to whole samples like juce::dsp::Reverb, the others keep the combs exact
+    // and round the all-passes, which only diffuse and don't set the pitch of anything.
+    using namespace Tunings;
+    const auto intCoreRate = static_cast<int> (coreRate);
+
+    auto combLength = [this, intCoreRate] (int tuning)
+    {
+        return coreMode == CoreMode::classic ? static_cast<double> (scaleLength (tuning, intCoreRate)) : exactLength (tuning, coreRate);
+    };
+
+    auto allPassLength = [this, intCoreRate] (int tuning)
+    {
+        return coreMode == CoreMode::classic ? scaleLength (tuning, intCoreRate) : juce::roundToInt (exactLength (tuning, coreRate));
+    };
+
+    referenceLength = combLength (combs[0]);
+
+    for (int i = 0; i < numCombs; ++i)
+    {
+        tanks[0].combs[i].setSize (combLength (combs[i]));
+        tanks[1].combs[i].setSize (combLength (combs[i] + stereoSpread));
+    }
+
+    for (int i = 0; i < numAllPasses; ++i)
+    {
+        tanks[0].allPasses[i].setSize (allPassLength (allPasses[i]));
+        tanks[1].allPasses[i].setSize (allPassLength (allPasses[i] + stereoSpread));
+    }
+
+    // Once the output has been quiet for a full trip through the longest comb plus the
+    // all-passes, nothing audible is left in the buffers.
+    auto longestPath = combs[numCombs - 1] + stereoSpread;
+
+    for (auto tuning : allPasses)
+        longestPath += tuning + stereoSpread;
+
+    sleepAfterSamples = scaleLength (longestPath, intCoreRate);
+
+    // The decay-time targets depend on the rate, and the comb lengths have just changed.
+    updateDamping();
+
+    for (auto& tank : tanks)
+        tank.setDecayPerSample (decayPerSample, referenceLength);
+
+    constexpr double smoothTime { 0.01 };
+    damping.reset (coreRate, smoothTime);
+    feedback.reset (coreRate, smoothTime);
+    dryGain.reset (spec.sampleRate, smoothTime);
+    wetGain1.reset (spec.sampleRate, smoothTime);
+    wetGain2.reset (spec.sampleRate, smoothTime);
+    earlyLevel.reset (spec.sampleRate, smoothTime);
+
+    constexpr double inputSmoothTime { 0.05 };
+    inputGain.reset (spec.sampleRate, inputSmoothTime);
+
+    freezeEngine.prepare (spec.sampleRate);
+    earlyReflections.prepare (spec.sampleRate);
+    gate.prepare (spec.sampleRate);
+
+    // A batch is normally the host block, rounded up to whole micro-blocks.
+    const auto maxBlockSize = juce::jmax (static_cast<int> (spec.maximumBlockSize), 1);
+    batchCapacity = juce::jmin (maxBatchCapacity, ((maxBlockSize + MicroBlock::size - 1) / MicroBlock::size) * MicroBlock::size);
+
+    if (rateFactor > 1)
+    {
+        decimator.prepare (rateFactor);
+
+        for (auto& interpolator : interpolators)
+            interpolator.prepare (rateFactor, batchCapacity);
+    }
+
+    scratchBuffer.setSize (numScratchChannels, batchCapacity);
+    scratchBuffer.clear();
+
+    for (int i = 0; i < numScratchChannels; ++i)
+        scratch[i] = scratchBuffer.getWritePointer (i);
+
+    // Unaligned batches start and end with a partial slice.
+    slices.resize (static_cast<size_t> (batchCapacity / MicroBlock::size + 2));
+    numSlices = 0;
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::reset()
+{
+    for (auto& tank : tanks)
+        tank.clear();
+
+    freezeEngine.reset();
+    earlyReflections.reset();
+    gate.reset();
+    numSlices = 0;
+
+    if (rateFactor > 1)
+    {
+        decimator.reset();
+
+        for (auto& interpolator : interpolators)
+            interpolator.reset();
+    }
+}
+
+template <typename SampleType>
+bool Reverb<SampleType>::isSleeping() const noexcept
+{
+    return tanks[0].sleeping && (numChannels < 2 || tanks[1].sleeping);
+}
+
+template <typename SampleType>
+int Reverb<SampleType>::countSubnormals() const noexcept
+{
+    const auto isSubnormal = [] (SampleType x) { return std::fpclassify (x) == FP_SUBNORMAL; };
+    int count = 0;
+
+    for (const auto& tank : tanks)
+    {
+        for (const auto& comb : tank.combs)
+        {
+            count += static_cast<int> (std::count_if (comb.buffer.begin(), comb.buffer.end(), isSubnormal));
+
+            for (auto state : { comb.last, comb.previousIn, comb.previousOut, comb.lowSplit, comb.highSplit })
+                count += isSubnormal (state) ? 1 : 0;
+        }
+
+        for (const auto& allPass : tank.allPasses)
+            count += static_cast<int> (std::count_if (allPass.buffer.begin(), allPass.buffer.end(), isSubnormal));
+    }
+
+    return count;
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::beginBatch (int newNumChannels) noexcept
+{
+    jassert (newNumChannels > 0 && newNumChannels <= 2);
+
+    numChannels = newNumChannels;
+    numSlices = 0;
+    numBatchSamples = 0;
+    numCoreSamples = 0;
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::setParameters (const Parameters& newParams)
+{
+    constexpr float wetScaleFactor { 3.0f };
+    constexpr float dryScaleFactor { 2.0f };
+
+    const auto wet = newParams.wetLevel * wetScaleFactor;
+    dryGain.setTargetValue (static_cast<SampleType> (newParams.dryLevel * dryScaleFactor));
+    wetGain1.setTargetValue (static_cast<SampleType> (0.5f * wet * (1.0f + newParams.width)));
+    wetGain2.setTargetValue (static_cast<SampleType> (0.5f * wet * (1.0f - newParams.width)));
+    earlyLevel.setTargetValue (static_cast<SampleType> (newParams.earlyLevel));
+
+    parameters = newParams;
+    inputGain.setTargetValue (isHolding() ? SampleType (0) : SampleType (0.015));
+    freezeEngine.setLooping (parameters.freeze && parameters.freezeMode != FreezeMode::hold,
+                             parameters.freezeMode == FreezeMode::loopWithLive);
+    updateDamping();
+
+    typename Gate<SampleType>::Parameters gateParameters;
+    gateParameters.enabled = newParams.gate;
+    gateParameters.threshold = newParams.gateThreshold;
+    gateParameters.hold = newParams.gateHold;
+    gateParameters.release = newParams.gateRelease;
+
+    gate.setParameters (gateParameters);
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::updateDamping() noexcept
+{
+    decayPerSample = SampleType (0);
+
+    if (isHolding())
+    {
+        damping.setTargetValue (SampleType (0));
+        feedback.setTargetValue (SampleType (1));
+    }
+    else if (parameters.useDecayTime)
+    {
+        const auto decay = Tunings::decayPerSample (static_cast<double> (parameters.decayTime), coreRate);
+        decayPerSample = static_cast<SampleType> (decay);
+
+        damping.setTargetValue (static_cast<SampleType> (Tunings::dampingForFrequency (parameters.dampingFrequency, coreRate)));
+        feedback.setTargetValue (static_cast<SampleType> (Tunings::feedbackForDecay (referenceLength, decay)));
+    }
+    else
+    {
+        damping.setTargetValue (static_cast<SampleType> (Tunings::dampingForDamp (parameters.damping)));
+        feedback.setTargetValue (static_cast<SampleType> (Tunings::feedbackForRoomSize (parameters.roomSize)));
+    }
+
+    // A held tail doesn't decay at all, in any band.
+    bandDecay = {};
+    bandDecay.active = ! isHolding() && (parameters.lowDecay != 1.0f || parameters.midDecay != 1.0f || parameters.highDecay != 1.0f);
+
+    if (! bandDecay.active)
+        return;
+
+    bandDecay.multipliers[0] = static_cast<SampleType> (parameters.lowDecay);
+    bandDecay.multipliers[1] = static_cast<SampleType> (parameters.midDecay);
+    bandDecay.multipliers[2] = static_cast<SampleType> (parameters.highDecay);
+
+    auto coefficientFor = [this] (float frequency)
+    {
+        return static_cast<SampleType> (1.0 - Tunings::dampingForFrequency (juce::jmin (static_cast<double> (frequency), 0.45 * coreRate), coreRate));
+    };
+
+    bandDecay.lowCoefficient = coefficientFor (parameters.lowCrossover);
+    bandDecay.highCoefficient = coefficientFor (parameters.highCrossover);
+}
+
+//==============================================================================
+template <typename SampleType>
+void Reverb<SampleType>::Tank::clear() noexcept
+{
+    for (auto& c : combs)
+        c.clear();
+
+    for (auto& a : allPasses)
+        a.clear();
+
+    sleeping = false;
+    silentSamples = 0;
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::Tank::park() noexcept
+{
+    if (sleeping)
+        return;
+
+    clear();
+    sleeping = true;
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::Tank::setDecayPerSample (SampleType newDecayPerSample, double referenceLength) noexcept
+{
+    decayPerSample = newDecayPerSample;
+
+    for (int i = 0; i < numCombs; ++i)
+        feedbackScales[i] = static_cast<SampleType> (Tunings::feedbackForDecay (combs[i].length - referenceLength, static_cast<double> (decayPerSample)));
+
+    updateBandGains();
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::Tank::setBandDecay (const BandDecay& newBands) noexcept
+{
+    // The splits pick up from the loop as it is, rather than from whatever they held when the
+    // bands were last on.
+    if (newBands.active && ! bands.active)
+    {
+        for (auto& c : combs)
+        {
+            c.lowSplit = c.last;
+            c.highSplit = c.last;
+        }
+    }
+
+    bands = newBands;
+    updateBandGains();
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::Tank::updateBandGains() noexcept
+{
+    if (! bands.active)
+        return;
+
+    for (int i = 0; i < numCombs; ++i)
+    {
+        auto& comb = combs[i];
+        const auto loopGain = static_cast<double> (bands.loopGain * feedbackScales[i]);
+
+        SampleType gains[3];
+
+        for (int band = 0; band < 3; ++band)
+            gains[band] = static_cast<SampleType> (Tunings::bandGainForMultiplier (loopGain, static_cast<double> (bands.multipliers[band])));
+
+        comb.bandGains[0] = gains[2];
+        comb.bandGains[1] = gains[1] - gains[2];
+        comb.bandGains[2] = gains[0] - gains[1];
+        comb.lowCoefficient = bands.lowCoefficient;
+        comb.highCoefficient = bands.highCoefficient;
+    }
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::CombFilter::setSize (double delay)
+{
+    length = delay;
+    fractional = delay != std::floor (delay);
+
+    // The interpolator adds between one and two samples of delay, its coefficient is closest to
+    // zero (and its phase delay flattest) in that range.
+    const auto size = fractional ? static_cast<int> (std::floor (delay)) - 1 : static_cast<int> (delay);
+    const auto interpolatorDelay = delay - size;
+    allPassCoefficient = static_cast<SampleType> (fractional ? (1.0 - interpolatorDelay) / (1.0 + interpolatorDelay) : 0.0);
+
+    // Slices are processed a filter at a time, which relies on every delay covering a micro-block.
+    jassert (size >= MicroBlock::size);
+
+    buffer.assign (static_cast<size_t> (juce::jmax (size, MicroBlock::size)), SampleType (0));
+    index = 0;
+    clear();
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::CombFilter::clear() noexcept
+{
+    std::fill (buffer.begin(), buffer.end(), SampleType (0));
+    last = SampleType (0);
+    previousIn = SampleType (0);
+    previousOut = SampleType (0);
+    lowSplit = SampleType (0);
+    highSplit = SampleType (0);
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::AllPassFilter::setSize (int size)
+{
+    jassert (size >= MicroBlock::size);
+
+    buffer.assign (static_cast<size_t> (juce::jmax (size, MicroBlock::size)), SampleType (0));
+    index = 0;
+}
+
+template <typename SampleType>
+void Reverb<SampleType>::AllPassFilter::clear() noexcept
+{
+    std::fill (buffer.begin(), buffer.end(), SampleType (0));
+}
+
+//==============================================================================
+template class Reverb<float>;
+template class Reverb<double>;
@@ -0,0 +1,695 @@
+/*
+  ==============================================================================
+
+    Reverb.h
+    Created: 19 Oct 2026 9:12:40am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include "EarlyReflections.h"
+#include "FreezeEngine.h"
+#include "Gate.h"
+#include "LevelMeter.h"
+#include "MicroBlock.h"
+#include "Resampler.h"
+#include "Tunings.h"
+
+enum class CoreMode
+{
+    classic,        // delay lengths truncated to whole samples at the host rate, as juce::dsp::Reverb
+    fractional,     // exact delay lengths at the host rate, the combs interpolate
+    reducedRate     // exact delay lengths, the tank runs at 44.1 or 48 kHz and is resampled
+};
+
+// Freeverb tank ported from juce::dsp::Reverb (same tunings, gain staging and smoothing) so the
+// loops can run a whole micro-block per filter and be specialised for its fixed length. It is
+// templated on the sample type so double-precision hosts get double-precision feedback loops.
+//
+// Audio is rendered a batch at a time in three passes. beginSlice() goes through the micro-blocks
+// in order and captures everything the tanks need, processTank() then runs one channel's tank over
+// the whole batch, and endSlice() mixes each micro-block back in order. The two tanks only share
+// read-only batch data, so they can run on different threads.
+template <typename SampleType>
+class Reverb
+{
+public:
+    struct Parameters
+    {
+        float roomSize { 0.5f };
+        float damping { 0.5f };
+        float wetLevel { 0.33f };
+        float dryLevel { 0.4f };
+        float width { 1.0f };
+        bool freeze { false };
+        FreezeMode freezeMode { FreezeMode::hold };
+
+        // Sets the tail in seconds and the damping by its crossover frequency, so it sounds the
+        // same at any sample rate. roomSize and damping are ignored while this is on.
+        bool useDecayTime { false };
+        float decayTime { 2.0f };
+        float dampingFrequency { 5000.0f };
+
+        // How many times as long as the rest of the tail the lows, mids and highs ring, and where
+        // the bands split. The split happens inside every comb's loop, on top of the damping.
+        float lowDecay { 1.0f };
+        float midDecay { 1.0f };
+        float highDecay { 1.0f };
+        float lowCrossover { 250.0f };
+        float highCrossover { 4000.0f };
+
+        // How much of the early reflections goes into the wet signal, and how much of the tail
+        // grows out of them rather than out of the direct sound.
+        float earlyLevel { 0.0f };
+
+        // Gates the wet signal by the input, for a tail that cuts off instead of dying away.
+        bool gate { false };
+        float gateThreshold { -30.0f };     // dB
+        float gateHold { 250.0f };          // ms
+        float gateRelease { 80.0f };        // ms
+    };
+
+    // Takes effect on the next prepare().
+    void setCoreMode (CoreMode newMode) noexcept { coreMode = newMode; }
+
+    void prepare (const juce::dsp::ProcessSpec& spec);
+    void reset();
+
+    void setParameters (const Parameters& newParams);
+    const Parameters& getParameters() const noexcept { return parameters; }
+
+    // Audio thread. Replaces the room the early reflections come from.
+    void setReflectionTaps (const ReflectionTaps& taps) noexcept { earlyReflections.setTaps (taps); }
+
+    // True while the tail has fully decayed and the comb networks are parked.
+    bool isSleeping() const noexcept;
+
+    // For measuring the tail itself. While off, a silent tail is never flushed and keeps decaying
+    // for as long as it is rendered. On by default.
+    void setSleepEnabled (bool shouldSleep) noexcept { sleepEnabled = shouldSleep; }
+
+    // How many values in the tanks' delay lines and filter states are subnormal right now. Walks
+    // every buffer, so it is for benchmarks rather than the audio thread.
+    int countSubnormals() const noexcept;
+
+    // Most samples a batch can hold. Longer host blocks have to be split.
+    int getBatchCapacity() const noexcept { return batchCapacity; }
+
+    // Starts a new, empty batch for a mono or stereo block.
+    void beginBatch (int numChannels) noexcept;
+
+    // Wet-only levels of every slice mixed since the last clear.
+    const BlockLevels& getWetLevels() const noexcept { return wetLevels; }
+    void clearWetLevels() noexcept { wetLevels.clear(); }
+
+    // While enabled, endSlice() also keeps a mono copy of the wet signal for the current batch.
+    void setWetTapEnabled (bool shouldBeEnabled) noexcept { wetTapEnabled = shouldBeEnabled; }
+    const SampleType* getWetTap() const noexcept { return scratch[wetTapChannel]; }
+
+    // First pass: captures a slice of at most MicroBlock::size samples that starts `offset`
+    // samples into the batch. Parameters set before this call apply from this slice on.
+    void beginSlice (const juce::dsp::AudioBlock<SampleType>& block, int offset) noexcept
+    {
+        const auto n = static_cast<int> (block.getNumSamples());
+
+        jassert (n <= MicroBlock::size && offset + n <= batchCapacity);
+        jassert (numSlices < static_cast<int> (slices.size()));
+        jassert (offset == numBatchSamples);
+
+        auto& slice = slices[static_cast<size_t> (numSlices++)];
+        slice.offset = offset;
+        slice.length = n;
+        numBatchSamples += n;
+
+        fillRamp (dryGain, scratch[dryChannel] + offset, n);
+        fillRamp (wetGain1, scratch[wet1Channel] + offset, n);
+        fillRamp (wetGain2, scratch[wet2Channel] + offset, n);
+
+        SampleType inputLevel[MicroBlock::size];
+        fillRamp (inputGain, inputLevel, n);
+
+        // At the host rate the input goes straight to the tanks, otherwise it is decimated first.
+        SampleType hostRateInput[MicroBlock::size];
+        auto* input = rateFactor == 1 ? scratch[inputChannel] + offset : hostRateInput;
+
+        if (numChannels > 1)
+            juce::FloatVectorOperations::add (input, block.getChannelPointer (0), block.getChannelPointer (1), n);
+        else
+            juce::FloatVectorOperations::copy (input, block.getChannelPointer (0), n);
+
+        slice.hasEarlyReflections = renderEarlyReflections (input, offset, n);
+        juce::FloatVectorOperations::multiply (input, inputLevel, n);
+
+        slice.inputIsSilent = peak (input, n) < silenceThreshold * inputGain.getTargetValue();
+        slice.decayPerSample = decayPerSample;
+        slice.coreOffset = numCoreSamples;
+        slice.coreLength = rateFactor == 1 ? n : decimator.process (input, n, scratch[inputChannel] + numCoreSamples);
+        numCoreSamples += slice.coreLength;
+
+        // The tank coefficients run at the tank's rate.
+        // A band that rings longer raises the loop gain, so it is worked out for the highest
+        // feedback the slice will see, which keeps it stable while the feedback ramps down.
+        slice.bands = bandDecay;
+
+        if (slice.bands.active)
+            slice.bands.loopGain = juce::jmax (feedback.getCurrentValue(), feedback.getTargetValue());
+
+        fillRamp (damping, scratch[dampChannel] + slice.coreOffset, slice.coreLength);
+        fillRamp (feedback, scratch[feedbackChannel] + slice.coreOffset, slice.coreLength);
+
+        slice.freeze = freezeEngine.advance (scratch[tankGainChannel] + offset, scratch[loopGainChannel] + offset, n);
+
+        // The gate listens to the dry input. A frozen tail is never parked, since the next hit
+        // should bring it back.
+        slice.isGated = gate.isEnabled();
+        slice.gateIsClosed = slice.isGated && gate.process (block, scratch[gateChannel] + offset) && ! parameters.freeze;
+    }
+
+    // Second pass: runs one channel's tank over every slice of the batch. Calls for different
+    // channels can be made concurrently.
+    void processTank (int channel) noexcept
+    {
+        auto& tank = tanks[channel];
+        auto* output = scratch[(rateFactor == 1 ? outLeftChannel : coreLeftChannel) + channel];
+        const auto sleepAfter = sleepEnabled ? sleepAfterSamples : std::numeric_limits<int>::max();
+
+        for (int i = 0; i < numSlices; ++i)
+        {
+            const auto& slice = slices[static_cast<size_t> (i)];
+            const auto offset = slice.coreOffset;
+            const auto length = slice.coreLength;
+
+            if (length == 0)
+                continue;
+
+            if (slice.decayPerSample != tank.decayPerSample)
+                tank.setDecayPerSample (slice.decayPerSample, referenceLength);
+
+            if (slice.bands != tank.bands)
+                tank.setBandDecay (slice.bands);
+
+            // While a looping freeze has fully taken over, the tank just holds its state.
+            if (slice.freeze.skipTank)
+            {
+                juce::FloatVectorOperations::clear (output + offset, length);
+                continue;
+            }
+
+            // Nothing the tank puts out gets past a closed gate, so it is parked as if its tail had
+            // died away, and the next hit starts it again from silence.
+            if (slice.gateIsClosed)
+            {
+                tank.park();
+                juce::FloatVectorOperations::clear (output + offset, length);
+                continue;
+            }
+
+            const auto* input = scratch[inputChannel] + offset;
+            const auto* damp = scratch[dampChannel] + offset;
+            const auto* feedbackLevel = scratch[feedbackChannel] + offset;
+
+            if (length == MicroBlock::size)
+                tank.process (input, output + offset, damp, feedbackLevel, slice.inputIsSilent, sleepAfter, MicroBlock::fullLength);
+            else
+                tank.process (input, output + offset, damp, feedbackLevel, slice.inputIsSilent, sleepAfter, length);
+        }
+
+        if (rateFactor > 1)
+            interpolators[channel].process (output, scratch[outLeftChannel + channel], numBatchSamples);
+    }
+
+    // Third pass: mixes the reverb into slice number `index` of the batch, in place. `wetGains`,
+    // if not null, holds a gain per sample for the wet signal, on top of the gate's.
+    void endSlice (const juce::dsp::AudioBlock<SampleType>& block, int index, const SampleType* wetGains = nullptr) noexcept
+    {
+        const auto& slice = slices[static_cast<size_t> (index)];
+        const auto offset = slice.offset;
+        const auto n = slice.length;
+
+        jassert (static_cast<int> (block.getNumSamples()) == n);
+
+        auto* left = block.getChannelPointer (0);
+        auto* right = numChannels > 1 ? block.getChannelPointer (1) : nullptr;
+        auto* outL = scratch[outLeftChannel] + offset;
+        auto* outR = right != nullptr ? scratch[outRightChannel] + offset : nullptr;
+
+        freezeEngine.process (slice.freeze, outL, outR, scratch[tankGainChannel] + offset, scratch[loopGainChannel] + offset, n);
+
+        // The reflections join the tail after the freeze, which only loops the tail, and ahead of
+        // the width matrix, so they narrow along with it.
+        if (slice.hasEarlyReflections)
+        {
+            const auto* earlyL = scratch[earlyLeftChannel] + offset;
+            const auto* earlyR = scratch[earlyRightChannel] + offset;
+
+            if (outR != nullptr)
+            {
+                juce::FloatVectorOperations::addWithMultiply (outL, earlyL, earlyOutputGain, n);
+                juce::FloatVectorOperations::addWithMultiply (outR, earlyR, earlyOutputGain, n);
+            }
+            else
+            {
+                juce::FloatVectorOperations::addWithMultiply (outL, earlyL, earlyOutputGain * SampleType (0.5), n);
+                juce::FloatVectorOperations::addWithMultiply (outL, earlyR, earlyOutputGain * SampleType (0.5), n);
+            }
+        }
+
+        const auto* dry = scratch[dryChannel] + offset;
+        const auto* wet1 = scratch[wet1Channel] + offset;
+        const auto* wet2 = scratch[wet2Channel] + offset;
+
+        // The output mix goes through JUCE's vector ops, which have SSE/NEON paths for both widths.
+        // The wet signal is built on its own first so it can be metered.
+        alignas (16) SampleType wetL[MicroBlock::size];
+        alignas (16) SampleType wetR[MicroBlock::size];
+
+        juce::FloatVectorOperations::multiply (wetL, outL, wet1, n);
+
+        if (right != nullptr)
+        {
+            juce::FloatVectorOperations::addWithMultiply (wetL, outR, wet2, n);
+
+            juce::FloatVectorOperations::multiply (wetR, outR, wet1, n);
+            juce::FloatVectorOperations::addWithMultiply (wetR, outL, wet2, n);
+        }
+
+        auto applyGains = [&] (const SampleType* gains)
+        {
+            juce::FloatVectorOperations::multiply (wetL, gains, n);
+
+            if (right != nullptr)
+                juce::FloatVectorOperations::multiply (wetR, gains, n);
+        };
+
+        if (slice.isGated)
+            applyGains (scratch[gateChannel] + offset);
+
+        if (wetGains != nullptr)
+            applyGains (wetGains);
+
+        const SampleType* wet[] { wetL, wetR };
+        wetLevels.add (wet, numChannels, n);
+
+        if (wetTapEnabled)
+        {
+            auto* tap = scratch[wetTapChannel] + offset;
+
+            if (right != nullptr)
+            {
+                juce::FloatVectorOperations::add (tap, wetL, wetR, n);
+                juce::FloatVectorOperations::multiply (tap, SampleType (0.5), n);
+            }
+            else
+            {
+                juce::FloatVectorOperations::copy (tap, wetL, n);
+            }
+        }
+
+        juce::FloatVectorOperations::multiply (left, dry, n);
+        juce::FloatVectorOperations::add (left, wetL, n);
+
+        if (right == nullptr)
+            return;
+
+        juce::FloatVectorOperations::multiply (right, dry, n);
+        juce::FloatVectorOperations::add (right, wetR, n);
+    }
+
+private:
+    bool isHolding() const noexcept { return parameters.freeze && parameters.freezeMode == FreezeMode::hold; }
+    void updateDamping() noexcept;
+
+    // Feeds the input of a slice through the early reflections, and crossfades the tank's input
+    // from the direct sound to them by the level. The reflections are brought back to the energy
+    // of the direct sound first, so the tail stays as loud. Returns false when there are none.
+    bool renderEarlyReflections (SampleType* input, int offset, int n) noexcept
+    {
+        // The level ramp runs whether or not it is needed, so it stays in step with the slices.
+        const auto isActive = earlyLevel.isSmoothing() || earlyLevel.getTargetValue() > SampleType (0);
+        SampleType level[MicroBlock::size];
+        fillRamp (earlyLevel, level, n);
+
+        earlyReflections.write (input, n);
+
+        auto* left = scratch[earlyLeftChannel] + offset;
+        auto* right = scratch[earlyRightChannel] + offset;
+
+        if (! isActive || ! earlyReflections.render (left, right, n))
+            return false;
+
+        // input += (reflections * tailGain - input) * level
+        SampleType feed[MicroBlock::size];
+        juce::FloatVectorOperations::add (feed, left, right, n);
+        juce::FloatVectorOperations::multiply (feed, earlyReflections.getTailGain(), n);
+        juce::FloatVectorOperations::subtract (feed, input, n);
+        juce::FloatVectorOperations::multiply (feed, level, n);
+        juce::FloatVectorOperations::add (input, feed, n);
+
+        juce::FloatVectorOperations::multiply (left, level, n);
+        juce::FloatVectorOperations::multiply (right, level, n);
+        return true;
+    }
+
+    static SampleType peak (const SampleType* samples, int numSamples) noexcept
+    {
+        const auto range = juce::FloatVectorOperations::findMinAndMax (samples, numSamples);
+        return juce::jmax (-range.getStart(), range.getEnd());
+    }
+
+    static void fillRamp (juce::SmoothedValue<SampleType>& value, SampleType* dest, int numSamples) noexcept
+    {
+        if (! value.isSmoothing())
+        {
+            juce::FloatVectorOperations::fill (dest, value.getTargetValue(), numSamples);
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = value.getNextValue();
+    }
+
+    // What the combs need to split their loops into bands.
+    struct BandDecay
+    {
+        bool active { false };
+        SampleType loopGain { 0 };
+        SampleType multipliers[3] { 1, 1, 1 };     // low, mid, high
+        SampleType lowCoefficient { 0 };
+        SampleType highCoefficient { 0 };
+
+        bool operator== (const BandDecay& other) const noexcept
+        {
+            return active == other.active && loopGain == other.loopGain
+                && std::equal (std::begin (multipliers), std::end (multipliers), std::begin (other.multipliers))
+                && lowCoefficient == other.lowCoefficient && highCoefficient == other.highCoefficient;
+        }
+
+        bool operator!= (const BandDecay& other) const noexcept { return ! operator== (other); }
+    };
+
+    struct CombFilter
+    {
+        // Whole-sample delays use the buffer as is. Anything else reads a first-order all-pass
+        // interpolator after it, which keeps the loop lossless where a linear one would damp it.
+        void setSize (double delay);
+        void clear() noexcept;
+
+        // Splits the loop into the lows below one one-pole, the highs above another and the mids
+        // left in between, which add back up to the input, and weights each band by its gain.
+        // Without bands the loop is left exactly as it was.
+        template <bool banded>
+        SampleType weightBands (SampleType x) noexcept
+        {
+            if constexpr (banded)
+            {
+                lowSplit += lowCoefficient * (x - lowSplit);
+                highSplit += highCoefficient * (x - highSplit);
+
+                return bandGains[0] * x + bandGains[1] * highSplit + bandGains[2] * lowSplit;
+            }
+            else
+            {
+                return x;
+            }
+        }
+
+        // Accumulates this comb's output for the slice into `output`. The damping filter is
+        // recursive, so this stays a per-sample loop, but it streams through one buffer at a time.
+        // The offset keeps the damping state out of the denormal range without relying on FTZ.
+        template <bool banded, typename Length>
+        void process (const SampleType* input, SampleType* output, const SampleType* damp, const SampleType* feedbackLevel,
+                      SampleType feedbackScale, SampleType offset, Length numSamples) noexcept
+        {
+            auto* data = buffer.data();
+            const auto size = static_cast<int> (buffer.size());
+
+            if (fractional)
+            {
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const auto buffered = data[index];
+                    const auto delayed = allPassCoefficient * (buffered - previousOut) + previousIn;
+                    previousIn = buffered;
+                    previousOut = delayed;
+
+                    last = (delayed * (SampleType (1) - damp[i])) + (last * damp[i]) + offset;
+                    data[index] = input[i] + (weightBands<banded> (last) * (feedbackLevel[i] * feedbackScale));
+
+                    if (++index == size)
+                        index = 0;
+
+                    output[i] += delayed;
+                }
+
+                return;
+            }
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const auto delayed = data[index];
+                last = (delayed * (SampleType (1) - damp[i])) + (last * damp[i]) + offset;
+                data[index] = input[i] + (weightBands<banded> (last) * (feedbackLevel[i] * feedbackScale));
+
+                if (++index == size)
+                    index = 0;
+
+                output[i] += delayed;
+            }
+        }
+
+        std::vector<SampleType> buffer;
+        int index { 0 };
+        SampleType last { 0 };
+
+        double length { 0.0 };
+        bool fractional { false };
+        SampleType allPassCoefficient { 0 };
+        SampleType previousIn { 0 };
+        SampleType previousOut { 0 };
+
+        // Band gains as high, mid - high and low - mid, which is all weightBands() needs.
+        SampleType bandGains[3] { 1, 0, 0 };
+        SampleType lowCoefficient { 0 };
+        SampleType highCoefficient { 0 };
+        SampleType lowSplit { 0 };
+        SampleType highSplit { 0 };
+    };
+
+    struct AllPassFilter
+    {
+        void setSize (int size);
+        void clear() noexcept;
+
+        // Every all-pass delay is longer than a micro-block, so nothing written in this slice is
+        // read back in it and each contiguous run of the buffer can be processed as a vector.
+        template <typename Length>
+        void process (SampleType* samples, Length numSamples) noexcept
+        {
+            const auto size = static_cast<int> (buffer.size());
+
+            for (int done = 0; done < numSamples;)
+            {
+                const auto run = juce::jmin (static_cast<int> (numSamples) - done, size - index);
+                auto* delayed = buffer.data() + index;
+                auto* s = samples + done;
+
+                for (int i = 0; i < run; ++i)
+                {
+                    // No offset needed here: the all-pass only feeds back through the combs'
+                    // output, which the comb offset already keeps normal.
+                    const auto buffered = delayed[i];
+                    delayed[i] = s[i] + (buffered * SampleType (0.5));
+                    s[i] = buffered - s[i];
+                }
+
+                done += run;
+                index += run;
+
+                if (index == size)
+                    index = 0;
+            }
+        }
+
+        std::vector<SampleType> buffer;
+        int index { 0 };
+    };
+
+    static constexpr int numCombs { Tunings::numCombs };
+    static constexpr int numAllPasses { Tunings::numAllPasses };
+
+    // -120 dB. A tail that stays below this for longer than the longest delay is flushed to zero.
+    static constexpr SampleType silenceThreshold { SampleType (1.0e-6) };
+
+    // One channel's comb and all-pass network. Everything it changes lives in here, which is what
+    // lets the two channels run in parallel.
+    struct Tank
+    {
+        void clear() noexcept;
+
+        // Flushes the buffers and sleeps until input returns, without waiting for the tail.
+        void park() noexcept;
+
+        // The feedback ramp is for a comb of `referenceLength`. In the decay-time mode every other
+        // comb is scaled from it so they all reach -60 dB together. Zero leaves them unscaled.
+        void setDecayPerSample (SampleType newDecayPerSample, double referenceLength) noexcept;
+
+        // Works out every comb's band gains from its own loop gain, so each band decays by the
+        // same multiple in all of them.
+        void setBandDecay (const BandDecay& newBands) noexcept;
+        void updateBandGains() noexcept;
+
+        // Writes the tank output for one slice. Once input and output have both stayed silent for
+        // `sleepAfterSamples`, the buffers are flushed and the tank sleeps until input returns.
+        template <typename Length>
+        void process (const SampleType* input, SampleType* output, const SampleType* damp, const SampleType* feedbackLevel,
+                      bool inputIsSilent, int sleepAfterSamples, Length numSamples) noexcept
+        {
+            const auto n = static_cast<int> (numSamples);
+            juce::FloatVectorOperations::clear (output, n);
+
+            if (sleeping)
+            {
+                if (inputIsSilent)
+                    return;
+
+                sleeping = false;
+            }
+
+            // Flipping the sign every slice keeps the offsets from building up a DC level.
+            denormalOffset = -denormalOffset;
+
+            for (int i = 0; i < numCombs; ++i)
+            {
+                if (bands.active)
+                    combs[i].template process<true> (input, output, damp, feedbackLevel, feedbackScales[i], denormalOffset, numSamples);
+                else
+                    combs[i].template process<false> (input, output, damp, feedbackLevel, feedbackScales[i], denormalOffset, numSamples);
+            }
+
+            for (auto& a : allPasses)
+                a.process (output, numSamples);
+
+            if (! inputIsSilent || peak (output, n) >= silenceThreshold)
+            {
+                silentSamples = 0;
+                return;
+            }
+
+            silentSamples += n;
+
+            // Clearing the buffers leaves exact zeros behind, so a parked tank can't hold any
+            // denormals and it wakes up from a clean state.
+            if (silentSamples >= sleepAfterSamples)
+            {
+                clear();
+                sleeping = true;
+            }
+        }
+
+        CombFilter combs[numCombs];
+        AllPassFilter allPasses[numAllPasses];
+
+        SampleType feedbackScales[numCombs] {};
+        SampleType decayPerSample { 0 };
+        BandDecay bands;
+
+        // Far below anything audible, far above the denormal range of float or double.
+        SampleType denormalOffset { SampleType (1.0e-20) };
+
+        bool sleeping { false };
+        int silentSamples { 0 };
+    };
+
+    struct Slice
+    {
+        int offset { 0 };
+        int length { 0 };
+        int coreOffset { 0 };   // where the slice is in the tank's input and output, which
+        int coreLength { 0 };   // differ from offset and length while running at a lower rate
+        bool inputIsSilent { false };
+        bool hasEarlyReflections { false };
+        bool isGated { false };
+        bool gateIsClosed { false };
+        SampleType decayPerSample { 0 };
+        BandDecay bands;
+        typename FreezeEngine<SampleType>::Slice freeze;
+    };
+
+    enum ScratchChannel
+    {
+        inputChannel,
+        dampChannel,
+        feedbackChannel,
+        dryChannel,
+        wet1Channel,
+        wet2Channel,
+        tankGainChannel,
+        loopGainChannel,
+        outLeftChannel,
+        outRightChannel,
+        coreLeftChannel,
+        coreRightChannel,
+        earlyLeftChannel,
+        earlyRightChannel,
+        gateChannel,
+        wetTapChannel,
+        numScratchChannels
+    };
+
+    // Larger offline blocks are split, this is already long enough for the batch overhead to vanish.
+    static constexpr int maxBatchCapacity { 8192 };
+
+    // The reflections come out at the level of the direct sound, far above the tank's output.
+    // This puts all of them together at about the energy of the whole tail.
+    static constexpr SampleType earlyOutputGain { SampleType (0.15) };
+
+    // Enough to bring 384 kHz down to 48 kHz.
+    static constexpr int maxRateFactor { 8 };
+
+    Parameters parameters;
+
+    int sleepAfterSamples { 0 };
+    bool sleepEnabled { true };
+
+    CoreMode coreMode { CoreMode::classic };
+
+    // The tank runs at the host rate divided by this. Everything else stays at the host rate.
+    int rateFactor { 1 };
+    double coreRate { 44100.0 };
+    double referenceLength { 0.0 };
+
+    HalfBandDecimator<SampleType> decimator;
+    HalfBandInterpolator<SampleType> interpolators[2];
+
+    // ln of the per-sample decay in the decay-time mode, 0 otherwise.
+    SampleType decayPerSample { 0 };
+    BandDecay bandDecay;
+
+    Tank tanks[2];
+    FreezeEngine<SampleType> freezeEngine;
+    EarlyReflections<SampleType> earlyReflections;
+    Gate<SampleType> gate;
+
+    juce::SmoothedValue<SampleType> damping, feedback, dryGain, wetGain1, wetGain2, earlyLevel;
+
+    // Ramping the input instead of cutting it keeps a hold freeze from clicking.
+    juce::SmoothedValue<SampleType> inputGain;
+
+    // Per-sample data for the current batch. The pointers are cached so the tanks never have to go
+    // through the buffer while running concurrently.
+    juce::AudioBuffer<SampleType> scratchBuffer;
+    SampleType* scratch[numScratchChannels] {};
+    std::vector<Slice> slices;
+    BlockLevels wetLevels;
+    int batchCapacity { 0 };
+    int numSlices { 0 };
+    int numBatchSamples { 0 };
+    int numCoreSamples { 0 };
+    int numChannels { 0 };
+    bool wetTapEnabled { false };
+};
@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    TableCache.cpp
+    Created: 19 Oct 2026 11:59:50pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "TableCache.h"
+#include <map>
+#include <mutex>
+
+namespace
+{
+    // Held weakly, so a table goes away with the last instance using it rather than staying
+    // around for the life of the process.
+    struct Entries
+    {
+        std::mutex lock;
+        std::map<juce::String, std::weak_ptr<const void>> tables;
+    };
+
+    Entries& getEntries()
+    {
+        static Entries entries;
+        return entries;
+    }
+}
+
+TableCache::Pointer<void> TableCache::find (const juce::String& key, const std::function<Pointer<void>()>& build)
+{
+    auto& entries = getEntries();
+    const std::lock_guard<std::mutex> lg (entries.lock);
+
+    auto& tables = entries.tables;
+
+    if (auto table = tables[key].lock())
+        return table;
+
+    // A handful of keys at most, so clearing out the ones nobody uses any more as they go by is enough.
+    for (auto it = tables.begin(); it != tables.end();)
+        it = it->second.expired() && it->first != key ? tables.erase (it) : std::next (it);
+
+    auto table = build();
+    tables[key] = table;
+    return table;
+}
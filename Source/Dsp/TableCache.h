@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+
+    TableCache.h
+    Created: 19 Oct 2026 11:59:50pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <functional>
+#include <memory>
+#include <typeinfo>
+
+// Read-only tables that come out the same in every instance: filter taps, fades, windows, FFT
+// plans. A table is built the first time it is asked for and then shared by everyone asking for
+// the same one, until the last of them lets go of it.
+//
+// Tables are looked up by a key naming everything their contents are computed from, e.g. the
+// length of a fade, so equal keys always mean equal contents. The type of the table is added to
+// the key here. Builders run under the cache's lock, so a table is built once even when several
+// instances prepare at the same time.
+//
+// Locks and allocates, so it is for prepare() and constructors, never the audio thread.
+namespace TableCache
+{
+    template <typename Table>
+    using Pointer = std::shared_ptr<const Table>;
+
+    Pointer<void> find (const juce::String& key, const std::function<Pointer<void>()>& build);
+
+    template <typename Table, typename Builder>
+    Pointer<Table> get (const juce::String& key, Builder&& build)
+    {
+        auto table = find (key + " " + typeid (Table).name(), [&build]() -> Pointer<void>
+        {
+            return std::make_shared<const Table> (build());
+        });
+
+        return std::static_pointer_cast<const Table> (table);
+    }
+}
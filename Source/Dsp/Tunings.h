@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    Tunings.h
+    Created: 19 Oct 2026 6:02:14pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+// The Freeverb constants juce::dsp::Reverb uses, shared by the reverb itself and by anything that
+// has to predict what it will do.
+namespace Tunings
+{
+inline constexpr int referenceSampleRate { 44100 };
+
+// Delay lengths in samples at the reference rate. The right channel adds stereoSpread to each.
+inline constexpr short combs[] { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+inline constexpr short allPasses[] { 556, 441, 341, 225 };
+inline constexpr int stereoSpread { 23 };
+
+inline constexpr int numCombs { static_cast<int> (sizeof (combs) / sizeof (combs[0])) };
+inline constexpr int numAllPasses { static_cast<int> (sizeof (allPasses) / sizeof (allPasses[0])) };
+
+// Scales a reference length to another rate, truncating like juce::dsp::Reverb.
+constexpr int scaleLength (int length, int sampleRate)
+{
+    return (sampleRate * length) / referenceSampleRate;
+}
+
+// The exact length at another rate, for delays that can interpolate.
+constexpr double exactLength (int length, double sampleRate)
+{
+    return length * sampleRate / referenceSampleRate;
+}
+
+// Maps the 0..1 size and damp parameters to the comb feedback and the damping filter's pole.
+constexpr float feedbackForRoomSize (float roomSize) { return roomSize * 0.28f + 0.7f; }
+constexpr float dampingForDamp (float damp) { return damp * 0.4f; }
+
+// The decay-time mode sets the tail directly in seconds. A comb decays by 60 dB in T seconds when
+// its feedback is 10^(-3 N / (T fs)), i.e. exp (decayPerSample * N) with the exponent below, which
+// only has to be solved once for all the combs.
+inline double decayPerSample (double decaySeconds, double sampleRate)
+{
+    return -3.0 * std::log (10.0) / (decaySeconds * sampleRate);
+}
+
+inline double feedbackForDecay (double length, double decayPerSample)
+{
+    return std::exp (decayPerSample * length);
+}
+
+// Pole of the one-pole damping filter for a crossover at `frequency`.
+inline double dampingForFrequency (double frequency, double sampleRate)
+{
+    return std::exp (-juce::MathConstants<double>::twoPi * frequency / sampleRate);
+}
+
+// A band decaying `multiplier` times as long as the rest of the comb needs a loop gain of
+// g^(1 / multiplier) instead of g, which is g times this. Unity loop gains stay as they are.
+inline double bandGainForMultiplier (double loopGain, double multiplier)
+{
+    return loopGain > 0.0 && loopGain < 1.0 ? std::pow (loopGain, 1.0 / multiplier - 1.0) : 1.0;
+}
+}
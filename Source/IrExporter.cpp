@@ -0,0 +1,148 @@
+/*
+  ==============================================================================
+
+    IrExporter.cpp
+    Created: 19 Oct 2026 11:58:36pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "IrExporter.h"
+#include "./Dsp/DecayEstimator.h"
+
+IrExporter::IrExporter() = default;
+
+IrExporter::~IrExporter()
+{
+    // Waits for blocks that are already rendering. Whatever was left to render is dropped.
+    exports.cancel();
+}
+
+bool IrExporter::start (const Request& newRequest)
+{
+    if (status.load() == Status::rendering)
+        return false;
+
+    // Nothing touches the request while nothing is rendering.
+    request = newRequest;
+    progress = 0.0f;
+
+    // Set first, a worker may already be done with it before submit() returns.
+    const auto previous = status.exchange (Status::rendering);
+
+    // It's the least urgent background work there is.
+    if (exports.submit (WorkerPool::Priority::low, [this] { return render(); }))
+        return true;
+
+    status = previous;
+    return false;
+}
+
+int IrExporter::render()
+{
+    if (engine == nullptr)
+        setUp();
+
+    const auto numSamples = juce::jmin (chunkSize * chunksPerRun, length - numRendered);
+
+    for (int done = 0; done < numSamples;)
+    {
+        const auto n = juce::jmin (chunkSize, numSamples - done);
+        juce::dsp::AudioBlock<double> block (response.getArrayOfWritePointers(), 2, static_cast<size_t> (numRendered + done), static_cast<size_t> (n));
+
+        const auto& settings = request.settings;
+        engine->process (block, block, [&settings] (int) { return settings; }, nullptr, nullptr);
+        done += n;
+    }
+
+    numRendered += numSamples;
+
+    // Once the tanks are asleep and the reflections are past, everything after is silence and the
+    // response ends here.
+    const auto reflectionsAreOver = numRendered > static_cast<int> (std::ceil (ReflectionTaps::maxDelaySeconds * request.sampleRate));
+    const auto isSilent = engine->isSleeping() && reflectionsAreOver;
+
+    if (numRendered < length && ! isSilent)
+    {
+        progress = static_cast<float> (numRendered) / static_cast<float> (length);
+        return 0;
+    }
+
+    if (! isSilent)
+    {
+        const auto fadeLength = juce::jmin (numRendered, static_cast<int> (fadeSeconds * request.sampleRate));
+
+        for (int channel = 0; channel < 2; ++channel)
+            response.applyGainRamp (channel, numRendered - fadeLength, fadeLength, 1.0, 0.0);
+    }
+
+    length = numRendered;
+
+    const auto written = write();
+    engine.reset();
+    response.setSize (0, 0);
+
+    progress = 1.0f;
+    status = written ? Status::finished : Status::failed;
+
+    return WorkerPool::done;
+}
+
+void IrExporter::setUp()
+{
+    auto& settings = request.settings;
+
+    // Ducking follows the programme rather than the room, and a frozen tail never ends, so both
+    // are left out. The gate is part of the sound and stays. The room is rendered at full level
+    // whatever the mix, as a convolution engine sets its own.
+    settings.duckDepth = 0.0f;
+    settings.freeze = false;
+    settings.wetLevel = 1.0f;
+    settings.dryLevel = 0.0f;
+    settings.bypass = false;
+
+    const auto estimate = estimateDecay (settings, request.sampleRate).getLongest();
+    auto seconds = static_cast<double> (estimate) + ReflectionTaps::maxDelaySeconds;
+
+    // A gate that is shut after the hold and release cuts the tail off.
+    if (settings.gate)
+        seconds = juce::jmin (seconds, static_cast<double> (settings.gateHold + settings.gateRelease) * 0.001 + ReflectionTaps::maxDelaySeconds);
+
+    length = static_cast<int> (std::ceil (juce::jlimit (fadeSeconds, maxLengthSeconds, seconds) * request.sampleRate));
+    numRendered = 0;
+
+    response.setSize (2, length);
+    response.clear();
+    response.setSample (0, 0, 1.0);
+
+    engine = std::make_unique<Engine<double>>();
+    engine->setSettings (settings, true);
+    engine->setCoreMode (request.coreMode);
+    engine->setReflectionTaps (computeImageSources (request.room));
+    engine->prepare ({ request.sampleRate, static_cast<juce::uint32> (chunkSize), 2 });
+    engine->reset();
+}
+
+bool IrExporter::write()
+{
+    request.file.deleteFile();
+    std::unique_ptr<juce::OutputStream> stream (request.file.createOutputStream());
+
+    if (stream == nullptr)
+        return false;
+
+    // 32-bit float, so a tail quieter than 24 bits can resolve still fades out smoothly.
+    std::unique_ptr<juce::AudioFormatWriter> writer (juce::WavAudioFormat().createWriterFor (stream.get(), request.sampleRate, 2, 32, {}, 0));
+
+    if (writer == nullptr)
+        return false;
+
+    // The writer owns the stream from here on.
+    stream.release();
+
+    juce::AudioBuffer<float> converted (2, length);
+    converted.makeCopyOf (response, true);
+
+    return writer->writeFromAudioSampleBuffer (converted, 0, length);
+}
@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+
+    IrExporter.h
+    Created: 19 Oct 2026 11:58:36pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "Settings.h"
+#include "./Concurrency/WorkerPool.h"
+#include "./Dsp/Engine.h"
+#include "./Dsp/ImageSource.h"
+
+// Bakes a sound into an impulse response file for convolution engines. An engine of its own is set
+// up like the live one and fed a unit impulse on the shared background workers, a few blocks at a
+// time so other background work gets a look in, which still runs far faster than real time and
+// never touches the audio thread.
+//
+// The tanks sum their inputs, so one impulse gives the whole response: the file is mono in,
+// stereo out and fully wet whatever the mix, so it is the room's own response. The dry path and
+// the balance are left to the convolver.
+class IrExporter final
+{
+public:
+    struct Request
+    {
+        Settings settings;
+        RoomGeometry room;
+        CoreMode coreMode { CoreMode::classic };
+        double sampleRate { 48000.0 };
+        juce::File file;
+    };
+
+    enum class Status
+    {
+        idle,
+        rendering,
+        finished,
+        failed
+    };
+
+    IrExporter();
+    ~IrExporter();
+
+    // Message thread. Returns false while the previous export is still rendering, or when the
+    // workers are too busy to take it.
+    bool start (const Request& request);
+
+    Status getStatus() const noexcept { return status.load(); }
+
+    // How far the current render has got, from 0 to 1.
+    float getProgress() const noexcept { return progress.load(); }
+
+    // Longest impulse response written, however long the tail is estimated to be.
+    static constexpr double maxLengthSeconds { 30.0 };
+
+private:
+    // Background worker. Renders the next few blocks and returns WorkerPool::done once written.
+    int render();
+    void setUp();
+    bool write();
+
+    static constexpr int chunkSize { 8192 };
+    static constexpr int chunksPerRun { 4 };
+
+    // A short fade where the render is cut at the estimated end, so the file doesn't click.
+    static constexpr double fadeSeconds { 0.01 };
+
+    // Set by start() while nothing is rendering, read by the worker afterwards.
+    Request request;
+
+    std::unique_ptr<Engine<double>> engine;
+    juce::AudioBuffer<double> response;
+    int numRendered { 0 };
+    int length { 0 };
+
+    std::atomic<Status> status { Status::idle };
+    std::atomic<float> progress { 0.0f };
+
+    juce::SharedResourcePointer<WorkerPool> workers;
+    WorkerPool::Token exports { *workers };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (IrExporter)
+};
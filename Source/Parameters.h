@@ -17,6 +17,44 @@ inline constexpr auto damp { "damp" };
 inline constexpr auto width { "width" };
 inline constexpr auto mix { "mix" };
 inline constexpr auto freeze { "freeze" };
+inline constexpr auto freezeMode { "freezeMode" };
+
+inline constexpr auto decayMode { "decayMode" };
+inline constexpr auto decayTime { "decayTime" };
+inline constexpr auto dampFreq { "dampFreq" };
+
+inline constexpr auto lowDecay { "lowDecay" };
+inline constexpr auto midDecay { "midDecay" };
+inline constexpr auto highDecay { "highDecay" };
+inline constexpr auto lowCrossover { "lowCrossover" };
+inline constexpr auto highCrossover { "highCrossover" };
+
+inline constexpr auto coreMode { "coreMode" };
+
+inline constexpr auto morph { "morph" };
+
+inline constexpr auto early { "early" };
+inline constexpr auto roomWidth { "roomWidth" };
+inline constexpr auto roomDepth { "roomDepth" };
+inline constexpr auto roomHeight { "roomHeight" };
+inline constexpr auto sourceX { "sourceX" };
+inline constexpr auto sourceY { "sourceY" };
+inline constexpr auto listenerX { "listenerX" };
+inline constexpr auto listenerY { "listenerY" };
+inline constexpr auto absorption { "absorption" };
+
+inline constexpr auto duckThreshold { "duckThreshold" };
+inline constexpr auto duckDepth { "duckDepth" };
+inline constexpr auto duckAttack { "duckAttack" };
+inline constexpr auto duckRelease { "duckRelease" };
+inline constexpr auto duckKey { "duckKey" };
+
+inline constexpr auto gate { "gate" };
+inline constexpr auto gateThreshold { "gateThreshold" };
+inline constexpr auto gateHold { "gateHold" };
+inline constexpr auto gateRelease { "gateRelease" };
+inline constexpr auto gateSync { "gateSync" };
+inline constexpr auto gateDivision { "gateDivision" };
 
 inline constexpr auto lowPass { "lowPass" };
 inline constexpr auto highPass { "highPass" };
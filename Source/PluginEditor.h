@@ -39,7 +39,7 @@ private:
     EditorContent editorContent;
     
     static constexpr auto defaultWidth { 690 };
-    static constexpr auto defaultHeight { 250 };
+    static constexpr auto defaultHeight { 712 };
     
     struct SharedLnf
        {
@@ -36,6 +36,13 @@ static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout
                 return juce::String { std::round ( value ) } + unit;
             });
     
+    const auto secondsLabels = juce::AudioParameterFloatAttributes().withStringFromValueFunction (
+            [] (auto value, auto)
+            {
+                constexpr auto unit = " s";
+                return juce::String { value, value < 10.0f ? 2 : 1 } + unit;
+            });
+    
     layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::size, 1 },
                                                             Parameters::size,
                                                             juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
@@ -64,6 +71,209 @@ static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout
                                                             Parameters::freeze,
                                                             false));
     
+    layout.add(std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { Parameters::freezeMode, 1},
+                                                            Parameters::freezeMode,
+                                                            juce::StringArray { "Hold", "Loop", "Loop + Live" },
+                                                            0));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::morph, 1 },
+                                                            Parameters::morph,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            0.0f,
+                                                            percentageLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterBool>   (juce::ParameterID { Parameters::decayMode, 1},
+                                                            Parameters::decayMode,
+                                                            false));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::decayTime, 1},
+                                                            Parameters::decayTime,
+                                                            juce::NormalisableRange { 0.1f, 20.0f, 0.01f, 0.3f},
+                                                            2.0f,
+                                                            secondsLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::dampFreq, 1},
+                                                            Parameters::dampFreq,
+                                                            juce::NormalisableRange { 200.0f, 20000.0f, 1.0f, 0.2f},
+                                                            5000.0f,
+                                                            frequencyLabels));
+    
+    const auto multiplierLabels = juce::AudioParameterFloatAttributes().withStringFromValueFunction (
+            [] (auto value, auto)
+            {
+                constexpr auto prefix = "x";
+                return prefix + juce::String { value, 2 };
+            });
+    
+    // Centred on x1, so the lows and highs are as easy to shorten as to lengthen.
+    auto multiplierRange = juce::NormalisableRange { 0.25f, 4.0f, 0.01f };
+    multiplierRange.setSkewForCentre (1.0f);
+    
+    for (auto* id : { Parameters::lowDecay, Parameters::midDecay, Parameters::highDecay })
+        layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { id, 1 },
+                                                                id,
+                                                                multiplierRange,
+                                                                1.0f,
+                                                                multiplierLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::lowCrossover, 1},
+                                                            Parameters::lowCrossover,
+                                                            juce::NormalisableRange { 50.0f, 1000.0f, 1.0f, 0.4f},
+                                                            250.0f,
+                                                            frequencyLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::highCrossover, 1},
+                                                            Parameters::highCrossover,
+                                                            juce::NormalisableRange { 1000.0f, 16000.0f, 1.0f, 0.3f},
+                                                            4000.0f,
+                                                            frequencyLabels));
+    
+    const auto metresLabels = juce::AudioParameterFloatAttributes().withStringFromValueFunction (
+            [] (auto value, auto)
+            {
+                constexpr auto unit = " m";
+                return juce::String { value, 1 } + unit;
+            });
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::early, 1 },
+                                                            Parameters::early,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            0.0f,
+                                                            percentageLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::roomWidth, 1 },
+                                                            Parameters::roomWidth,
+                                                            juce::NormalisableRange { 2.0f, 30.0f, 0.1f, 0.5f },
+                                                            8.0f,
+                                                            metresLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::roomDepth, 1 },
+                                                            Parameters::roomDepth,
+                                                            juce::NormalisableRange { 2.0f, 30.0f, 0.1f, 0.5f },
+                                                            12.0f,
+                                                            metresLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::roomHeight, 1 },
+                                                            Parameters::roomHeight,
+                                                            juce::NormalisableRange { 2.0f, 12.0f, 0.1f, 0.5f },
+                                                            3.5f,
+                                                            metresLabels));
+    
+    // Positions are proportions of the width (left to right) and depth (back to front).
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::sourceX, 1 },
+                                                            Parameters::sourceX,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            35.0f,
+                                                            percentageLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::sourceY, 1 },
+                                                            Parameters::sourceY,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            70.0f,
+                                                            percentageLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::listenerX, 1 },
+                                                            Parameters::listenerX,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            50.0f,
+                                                            percentageLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::listenerY, 1 },
+                                                            Parameters::listenerY,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            25.0f,
+                                                            percentageLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::absorption, 1 },
+                                                            Parameters::absorption,
+                                                            juce::NormalisableRange { 0.0f, 100.0f, 0.01f, 1.0f },
+                                                            30.0f,
+                                                            percentageLabels));
+    
+    const auto decibelLabels = juce::AudioParameterFloatAttributes().withStringFromValueFunction (
+            [] (auto value, auto)
+            {
+                constexpr auto unit = " dB";
+                return juce::String { value, 1 } + unit;
+            });
+    
+    const auto millisecondsLabels = juce::AudioParameterFloatAttributes().withStringFromValueFunction (
+            [] (auto value, auto)
+            {
+                constexpr auto unit = " ms";
+                return juce::String { value, value < 10.0f ? 1 : 0 } + unit;
+            });
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::duckThreshold, 1 },
+                                                            Parameters::duckThreshold,
+                                                            juce::NormalisableRange { -60.0f, 0.0f, 0.1f, 1.0f },
+                                                            -24.0f,
+                                                            decibelLabels));
+    
+    // No depth, no ducking.
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::duckDepth, 1 },
+                                                            Parameters::duckDepth,
+                                                            juce::NormalisableRange { 0.0f, 40.0f, 0.1f, 1.0f },
+                                                            0.0f,
+                                                            decibelLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::duckAttack, 1 },
+                                                            Parameters::duckAttack,
+                                                            juce::NormalisableRange { 0.1f, 100.0f, 0.1f, 0.4f },
+                                                            5.0f,
+                                                            millisecondsLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::duckRelease, 1 },
+                                                            Parameters::duckRelease,
+                                                            juce::NormalisableRange { 10.0f, 2000.0f, 1.0f, 0.4f },
+                                                            250.0f,
+                                                            millisecondsLabels));
+    
+    // Without a sidechain connected, the main input keys the ducking either way.
+    layout.add(std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { Parameters::duckKey, 1},
+                                                            Parameters::duckKey,
+                                                            juce::StringArray { "Input", "Sidechain" },
+                                                            0));
+    
+    layout.add(std::make_unique<juce::AudioParameterBool>   (juce::ParameterID { Parameters::gate, 1},
+                                                            Parameters::gate,
+                                                            false));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::gateThreshold, 1 },
+                                                            Parameters::gateThreshold,
+                                                            juce::NormalisableRange { -60.0f, 0.0f, 0.1f, 1.0f },
+                                                            -30.0f,
+                                                            decibelLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::gateHold, 1 },
+                                                            Parameters::gateHold,
+                                                            juce::NormalisableRange { 10.0f, 2000.0f, 1.0f, 0.4f },
+                                                            250.0f,
+                                                            millisecondsLabels));
+    
+    layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::gateRelease, 1 },
+                                                            Parameters::gateRelease,
+                                                            juce::NormalisableRange { 1.0f, 1000.0f, 1.0f, 0.4f },
+                                                            80.0f,
+                                                            millisecondsLabels));
+    
+    // While synced, the hold is the chosen note at the host's tempo and the hold time is ignored.
+    layout.add(std::make_unique<juce::AudioParameterBool>   (juce::ParameterID { Parameters::gateSync, 1},
+                                                            Parameters::gateSync,
+                                                            false));
+    
+    layout.add(std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { Parameters::gateDivision, 1},
+                                                            Parameters::gateDivision,
+                                                            juce::StringArray { "1/32", "1/16", "1/8", "1/4", "1/2", "1/1" },
+                                                            3));
+    
+    // Changing this reallocates the delay lines, so it isn't offered to automation.
+    layout.add(std::make_unique<juce::AudioParameterChoice> (juce::ParameterID { Parameters::coreMode, 1},
+                                                            Parameters::coreMode,
+                                                            juce::StringArray { "Classic", "Fractional", "Reduced rate" },
+                                                            0,
+                                                            juce::AudioParameterChoiceAttributes().withAutomatable (false)));
+    
     layout.add(std::make_unique<juce::AudioParameterFloat>  (juce::ParameterID { Parameters::lowPass, 1},
                                                             Parameters::lowPass,
                                                             juce::NormalisableRange { 20.0f, 20000.0f, 1.0f, 0.2f},
@@ -90,16 +300,29 @@ SimpleRoomReverbAudioProcessor::SimpleRoomReverbAudioProcessor()
                      #if ! JucePlugin_IsMidiEffect
                       #if ! JucePlugin_IsSynth
                        .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
+                       .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false)
                       #endif
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
                        ), apvts (*this, &undoManager, "pluginParameters", createParameterLayout())
 #endif
 {
+    for (auto* id : decayParameters)
+        apvts.addParameterListener (id, this);
+    
+    apvts.addParameterListener (Parameters::coreMode, this);
+    
+    updateDecayEstimate();
 }
 
 SimpleRoomReverbAudioProcessor::~SimpleRoomReverbAudioProcessor()
 {
+    cancelPendingUpdate();
+    
+    for (auto* id : decayParameters)
+        apvts.removeParameterListener (id, this);
+    
+    apvts.removeParameterListener (Parameters::coreMode, this);
 }
 
 //==============================================================================
@@ -137,31 +360,174 @@ bool SimpleRoomReverbAudioProcessor::isMidiEffect() const
 
 double SimpleRoomReverbAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return tailLengthSeconds.load();
+}
+
+void SimpleRoomReverbAudioProcessor::parameterChanged (const juce::String& parameterID, float newValue)
+{
+    juce::ignoreUnused (newValue);
+    
+    if (parameterID == Parameters::coreMode)
+        coreModeChanged = true;
+    
+    // This can be the audio thread, so the work itself is left to the message thread.
+    triggerAsyncUpdate();
+}
+
+void SimpleRoomReverbAudioProcessor::handleAsyncUpdate()
+{
+    applyPendingProgram();
+    
+    if (isNonRealtime())
+        forkJoinPool->start();
+    
+    // The delay lines have to be reallocated. Suspending waits for the block in flight to finish
+    // and keeps the host from calling processBlock() until they are ready.
+    if (coreModeChanged.exchange (false) && getSampleRate() > 0.0)
+    {
+        suspendProcessing (true);
+        prepareToPlay (getSampleRate(), getBlockSize());
+        suspendProcessing (false);
+    }
+    
+    updateDecayEstimate();
+}
+
+void SimpleRoomReverbAudioProcessor::updateDecayEstimate()
+{
+    const auto sampleRate = getSampleRate() > 0.0 ? getSampleRate() : 44100.0;
+    auto target = getSettings (apvts);
+    snapshotMorph.applyForMessageThread (target, getMorphPosition());
+    decayEstimate = estimateDecay (target, sampleRate);
+    
+    const auto longest = decayEstimate.getLongest();
+    tailLengthSeconds = std::isinf (longest) ? std::numeric_limits<double>::infinity() : static_cast<double> (longest);
 }
 
 int SimpleRoomReverbAudioProcessor::getNumPrograms()
 {
-    return 1;   // NB: some hosts don't cope very well if you tell them there are 0 programs,
-                // so this should be at least 1, even if you're not really implementing programs.
+    return programBank.getNumPrograms();
 }
 
 int SimpleRoomReverbAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
 void SimpleRoomReverbAudioProcessor::setCurrentProgram (int index)
 {
+    // Some hosts call this from the audio thread, so it sticks to atomics.
+    const auto* program = programBank.getProgram (index);
+    
+    if (program == nullptr)
+        return;
+    
+    currentProgram = index;
+    pendingProgram = program;
+    triggerAsyncUpdate();
 }
 
 const juce::String SimpleRoomReverbAudioProcessor::getProgramName (int index)
 {
+    if (const auto* program = programBank.getProgram (index))
+        return program->name;
+    
     return {};
 }
 
 void SimpleRoomReverbAudioProcessor::changeProgramName (int index, const juce::String& newName)
 {
+    // Programs are renamed by saving them again under the new name.
+    juce::ignoreUnused (index, newName);
+}
+
+bool SimpleRoomReverbAudioProcessor::saveUserProgram (const juce::String& name)
+{
+    const auto index = programBank.saveUserProgram (name);
+    
+    if (index < 0)
+        return false;
+    
+    // The values are already in the parameters, only the number changes.
+    currentProgram = index;
+    updateHostDisplay (ChangeDetails().withProgramChanged (true));
+    return true;
+}
+
+bool SimpleRoomReverbAudioProcessor::exportImpulseResponse (const juce::File& file)
+{
+    IrExporter::Request request;
+    request.settings = getSettings (apvts);
+    snapshotMorph.applyForMessageThread (request.settings, getMorphPosition());
+    
+    if (request.settings.gateSync)
+        request.settings.gateHold = gateHoldForTempo (request.settings.gateDivision, hostBpm.load());
+    
+    request.room = roomModel.getGeometry();
+    request.coreMode = static_cast<CoreMode> (apvts.getRawParameterValue (Parameters::coreMode)->load());
+    request.sampleRate = getSampleRate() > 0.0 ? getSampleRate() : 48000.0;
+    request.file = file;
+    
+    return irExporter.start (request);
+}
+
+Settings SimpleRoomReverbAudioProcessor::getTargetSettings() noexcept
+{
+    auto target = getSettings (apvts);
+    
+    // The program stands in for its own parameters only. Bypass and the duck key belong to the
+    // session (see ProgramBank::programParameters), so they stay as they are across the switch.
+    if (const auto* program = pendingProgram.load())
+    {
+        const auto bypass = target.bypass;
+        const auto duckSidechain = target.duckSidechain;
+        target = program->settings;
+        target.bypass = bypass;
+        target.duckSidechain = duckSidechain;
+    }
+    
+    // The morph is left to each micro-block, see process().
+    return target;
+}
+
+float SimpleRoomReverbAudioProcessor::getMorphPosition() const noexcept
+{
+    return apvts.getRawParameterValue (Parameters::morph)->load() * 0.01f;
+}
+
+void SimpleRoomReverbAudioProcessor::captureSnapshot (SnapshotMorph::Slot slot)
+{
+    snapshotMorph.capture (slot, apvts);
+    triggerAsyncUpdate();
+}
+
+void SimpleRoomReverbAudioProcessor::clearSnapshots()
+{
+    snapshotMorph.clear();
+    triggerAsyncUpdate();
+}
+
+void SimpleRoomReverbAudioProcessor::applyPendingProgram()
+{
+    const auto* program = pendingProgram.load();
+    
+    if (program == nullptr)
+        return;
+    
+    // One undoable step, like any other edit, and the host hears about every parameter.
+    undoManager.beginNewTransaction ("Load " + program->name);
+    
+    for (const auto& [id, value] : program->values)
+    {
+        auto* parameter = apvts.getParameter (id);
+        parameter->beginChangeGesture();
+        parameter->setValueNotifyingHost (parameter->convertTo0to1 (value));
+        parameter->endChangeGesture();
+    }
+    
+    // Unless the host has already moved on to another program, the parameters now say the same.
+    pendingProgram.compare_exchange_strong (program, nullptr);
+    updateHostDisplay (ChangeDetails().withProgramChanged (true));
 }
 
 //==============================================================================
@@ -178,14 +544,42 @@ void SimpleRoomReverbAudioProcessor::prepareToPlay (double sampleRate, int sampl
     spec.maximumBlockSize = samplesPerBlock;
     spec.numChannels = getTotalNumOutputChannels();
     
-    reverb.prepare(spec);
-    lowPassFilter.prepare(spec);
-    highPassFilter.prepare(spec);
+    // Not concurrent with processBlock(), so this can stand in for the audio thread's read.
+    auto target = getTargetSettings();
+    snapshotMorph.apply (target, getMorphPosition());
+    settingsRamp.reset (target);
+    loadMeasurer.reset (sampleRate, samplesPerBlock);
+    triggerAsyncUpdate();
+    
+    inputMeter.prepare (sampleRate);
+    wetMeter.prepare (sampleRate);
+    outputMeter.prepare (sampleRate);
+    
+    // Offline renders with large blocks split the tanks across the shared helper threads.
+    if (isNonRealtime())
+        forkJoinPool->start();
+    
+    // Only the engine matching the host's precision gets its delay lines allocated.
+    if (isUsingDoublePrecision())
+        prepareEngine (doubleEngine, spec);
+    else
+        prepareEngine (floatEngine, spec);
+}
+
+template <typename SampleType>
+void SimpleRoomReverbAudioProcessor::prepareEngine (Engine<SampleType>& engine, const juce::dsp::ProcessSpec& spec)
+{
+    // Settings go in first so prepare() starts the smoothers at their targets instead of ramping.
+    engine.setSettings (settingsRamp.getCurrent(), true);
+    engine.setCoreMode (static_cast<CoreMode> (apvts.getRawParameterValue (Parameters::coreMode)->load()));
+    
+    // Whichever taps are newest, the other engine may not have had them yet.
+    roomModel.pullTaps (reflectionTaps);
+    engine.setReflectionTaps (reflectionTaps);
+    engine.prepare(spec);
     
     if (firstTimeInitializing) {
-        reverb.reset();
-        lowPassFilter.reset();
-        highPassFilter.reset();
+        engine.reset();
         
         firstTimeInitializing = false;
     }
@@ -216,6 +610,14 @@ bool SimpleRoomReverbAudioProcessor::isBusesLayoutSupported (const BusesLayout&
    #if ! JucePlugin_IsSynth
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
+    
+    // The sidechain is optional and only ever read as the ducking key, so anything up to stereo will do.
+    const auto sidechain = layouts.getChannelSet (true, 1);
+    
+    if (! sidechain.isDisabled()
+     && sidechain != juce::AudioChannelSet::mono()
+     && sidechain != juce::AudioChannelSet::stereo())
+        return false;
    #endif
 
     return true;
@@ -224,20 +626,7 @@ bool SimpleRoomReverbAudioProcessor::isBusesLayoutSupported (const BusesLayout&
 #endif
 
 Settings getSettings(juce::AudioProcessorValueTreeState& apvts){
-    Settings settings;
-    
-    // Multiply by 0.01 for scaling refactor as juce::dsp::Reverb::Parameters expects a value between 0.0 and 1.0.
-    settings.size = apvts.getRawParameterValue(Parameters::size)->load() * 0.01f;
-    settings.damp = apvts.getRawParameterValue(Parameters::damp)->load() * 0.01f;
-    settings.width = apvts.getRawParameterValue(Parameters::width)->load() * 0.01f;
-    settings.wetLevel = apvts.getRawParameterValue(Parameters::mix)->load() * 0.01f;
-    settings.dryLevel = 1.0f - settings.wetLevel;
-    settings.freeze = apvts.getRawParameterValue(Parameters::freeze)->load();
-    settings.lowPassFreq = apvts.getRawParameterValue(Parameters::lowPass)->load();
-    settings.highPassFreq = apvts.getRawParameterValue(Parameters::highPass)->load();
-    settings.bypass = apvts.getRawParameterValue(Parameters::bypass)->load();
-    
-    return settings;
+    return makeSettings ([&apvts] (const char* id) { return apvts.getRawParameterValue (id)->load(); });
 }
 
 bool SimpleRoomReverbAudioProcessor::isBypassed(){
@@ -245,38 +634,39 @@ bool SimpleRoomReverbAudioProcessor::isBypassed(){
     return settings.bypass;
 }
 
-void SimpleRoomReverbAudioProcessor::updateFilters() {
-    auto settings = getSettings(apvts);
-    
-    float resonance = 1 / sqrt(2);
-    float lowPassFreq = settings.lowPassFreq;
-    float highPassFreq = settings.highPassFreq;
-    
-    lowPassFilter.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-    lowPassFilter.setResonance(resonance);
-    lowPassFilter.setCutoffFrequency(lowPassFreq);
-    
-    highPassFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-    highPassFilter.setResonance(resonance);
-    highPassFilter.setCutoffFrequency(highPassFreq);
+bool SimpleRoomReverbAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
 }
 
-void SimpleRoomReverbAudioProcessor::updateReverbParameters() {
-    auto settings = getSettings(apvts);
-    
-    reverbParameters.roomSize = settings.size;
-    reverbParameters.damping = settings.damp;
-    reverbParameters.width = settings.width;
-    reverbParameters.wetLevel = settings.wetLevel;
-    reverbParameters.dryLevel = settings.dryLevel;
-    reverbParameters.freezeMode = settings.freeze;
+void SimpleRoomReverbAudioProcessor::setNonRealtime (bool isNonRealtime) noexcept
+{
+    AudioProcessor::setNonRealtime (isNonRealtime);
     
-    reverb.setParameters(reverbParameters);
+    // This can be the render thread, which mustn't create threads. Some hosts switch to offline
+    // rendering without preparing again, so the helpers are started on the message thread, and
+    // blocks run on the caller alone until they are.
+    if (isNonRealtime)
+        triggerAsyncUpdate();
 }
 
 void SimpleRoomReverbAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    process (buffer, floatEngine);
+}
+
+void SimpleRoomReverbAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    process (buffer, doubleEngine);
+}
+
+template <typename SampleType>
+void SimpleRoomReverbAudioProcessor::process (juce::AudioBuffer<SampleType>& buffer, Engine<SampleType>& engine)
 {
     juce::ScopedNoDenormals noDenormals;
+    const juce::AudioProcessLoadMeasurer::ScopedTimer loadTimer (loadMeasurer, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -289,19 +679,107 @@ void SimpleRoomReverbAudioProcessor::processBlock (juce::AudioBuffer<float>& buf
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    updateFilters();
-    updateReverbParameters();
-    
+    BlockLevels inputLevels;
+    inputLevels.add (buffer.getArrayOfReadPointers(), juce::jmin (getMainBusNumInputChannels(), buffer.getNumChannels()), buffer.getNumSamples());
+    inputMeter.update (inputLevels);
+
     if (isBypassed())
     {
+        // The input passes straight through and the reverb is silent.
+        BlockLevels silence;
+        silence.numChannels = inputLevels.numChannels;
+        silence.numSamples = inputLevels.numSamples;
+        
+        wetMeter.update (silence);
+        outputMeter.update (inputLevels);
+        publishTelemetry (engine.isSleeping());
         return;
     }
 
-    juce::dsp::AudioBlock<float> block (buffer);
-    juce::dsp::ProcessContextReplacing<float> context (block);
-    reverb.process(context);
-    lowPassFilter.process(context);
-    highPassFilter.process(context);
+    // The buffer holds the sidechain's channels as well, after the main ones.
+    auto mainBuffer = getBusBuffer (buffer, false, 0);
+    juce::dsp::AudioBlock<SampleType> block (mainBuffer);
+    
+    // Snapshots only change at micro-block boundaries, which bounds the coefficient updates to
+    // one per micro-block however dense the automation is.
+    auto target = getTargetSettings();
+    
+    // A tempo change ramps the synced hold like any automation would.
+    if (target.gateSync)
+        target.gateHold = gateHoldForTempo (target.gateDivision, getHostBpm());
+    
+    if (roomModel.pullTaps (reflectionTaps))
+        engine.setReflectionTaps (reflectionTaps);
+    
+    // Whatever the host buffer size, the DSP only ever sees micro-blocks, and the ramp steps once
+    // per micro-block, so automation lands on the same samples every time. The morph position is
+    // read and blended at every micro-block rather than once per block, so a host that moves it
+    // within a long block is followed at micro-block resolution.
+    const auto settingsAt = [this, &target] (int)
+    {
+        auto morphed = target;
+        snapshotMorph.apply (morphed, getMorphPosition());
+        settingsRamp.setTarget (morphed);
+        return settingsRamp.next();
+    };
+    
+    // Splitting the tanks only pays off once a block holds enough work to cover the hand-over,
+    // and it involves locks, so it is kept to offline renders. The output is the same either way.
+    const auto useForkJoin = isNonRealtime()
+                          && buffer.getNumSamples() >= minForkJoinBlockSize
+                          && forkJoinPool->isRunning();
+    
+    // The sidechain only takes over as the key while it is selected and the host has connected it.
+    const auto* sidechainBus = getBus (true, 1);
+    const auto useSidechain = target.duckSidechain
+                           && sidechainBus != nullptr
+                           && sidechainBus->isEnabled()
+                           && sidechainBus->getNumberOfChannels() > 0;
+    
+    const auto keyBuffer = getBusBuffer (buffer, true, useSidechain ? 1 : 0);
+    const juce::dsp::AudioBlock<const SampleType> key (keyBuffer);
+    
+    engine.process (block,
+                    key,
+                    settingsAt,
+                    useForkJoin ? forkJoinPool.get() : nullptr,
+                    wetTapActive.load (std::memory_order_relaxed) ? &wetTap : nullptr);
+    
+    BlockLevels outputLevels;
+    outputLevels.add (buffer.getArrayOfReadPointers(), juce::jmin (totalNumOutputChannels, buffer.getNumChannels()), buffer.getNumSamples());
+    outputMeter.update (outputLevels);
+    wetMeter.update (engine.getWetLevels());
+    
+    publishTelemetry (engine.isSleeping());
+}
+
+double SimpleRoomReverbAudioProcessor::getHostBpm() noexcept
+{
+    if (auto* playHead = getPlayHead())
+        if (const auto position = playHead->getPosition())
+            if (const auto bpm = position->getBpm(); bpm.hasValue() && *bpm > 0.0)
+                hostBpm.store (*bpm);
+    
+    return hostBpm.load();
+}
+
+void SimpleRoomReverbAudioProcessor::publishTelemetry (bool tailIsSleeping) noexcept
+{
+    // The load measured here runs up to the previous block, this one is still being timed.
+    Telemetry t;
+    t.cpuLoad = static_cast<float> (loadMeasurer.getLoadAsProportion());
+    t.xRunCount = loadMeasurer.getXRunCount();
+    t.tailIsSleeping = tailIsSleeping;
+    t.input = inputMeter.getReading();
+    t.wet = wetMeter.getReading();
+    t.output = outputMeter.getReading();
+    
+    telemetry.write (t);
+}
+
+bool SimpleRoomReverbAudioProcessor::pullTelemetry (Telemetry& dest) noexcept
+{
+    return telemetry.read (dest);
 }
 
 //==============================================================================
@@ -323,8 +801,13 @@ void SimpleRoomReverbAudioProcessor::getStateInformation (juce::MemoryBlock& des
     // You could do that either as raw data, or use the XML or ValueTree classes
     // as intermediaries to make it easy to save and load complex data.
     
+    // The program number goes along so the host's program list shows the right one on reload.
+    auto state = apvts.copyState();
+    state.setProperty ("program", currentProgram.load(), nullptr);
+    snapshotMorph.saveTo (state);
+    
     juce::MemoryOutputStream mos(destData, true);
-    apvts.state.writeToStream (mos);
+    state.writeToStream (mos);
 }
 
 void SimpleRoomReverbAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
@@ -333,9 +816,14 @@ void SimpleRoomReverbAudioProcessor::setStateInformation (const void* data, int
     // whose contents will have been created by the getStateInformation() call.
     
     if (const auto tree = juce::ValueTree::readFromData(data, static_cast<size_t>(sizeInBytes)); tree.isValid())
+    {
         apvts.replaceState (tree);
-        updateFilters();
-        updateReverbParameters();
+        snapshotMorph.loadFrom (tree);
+        triggerAsyncUpdate();
+        currentProgram = juce::jlimit (0, programBank.getNumPrograms() - 1, static_cast<int> (tree.getProperty ("program", 0)));
+    }
+    
+    // The audio thread picks the restored values up at its next micro-block boundary.
 }
 
 juce::AudioProcessorValueTreeState& SimpleRoomReverbAudioProcessor::getPluginState() { return apvts; }
@@ -11,18 +11,20 @@
 #include <JuceHeader.h>
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
-
-struct Settings {
-    float size { 0 };
-    float damp { 0 };
-    float width { 0 };
-    float wetLevel { 0 };
-    float dryLevel { 0 };
-    bool freeze { false };
-    float lowPassFreq { 0 };
-    float highPassFreq { 0 };
-    bool bypass { false };
-};
+#include "IrExporter.h"
+#include "Parameters.h"
+#include "ProgramBank.h"
+#include "RoomModel.h"
+#include "Settings.h"
+#include "SnapshotMorph.h"
+#include "Telemetry.h"
+#include "./Concurrency/ForkJoinPool.h"
+#include "./Concurrency/SpscRingBuffer.h"
+#include "./Concurrency/TripleBuffer.h"
+#include "./Dsp/DecayEstimator.h"
+#include "./Dsp/Engine.h"
+#include "./Dsp/LevelMeter.h"
+#include "./Dsp/MicroBlock.h"
 
 Settings getSettings(juce::AudioProcessorValueTreeState& apvts);
 
@@ -30,6 +32,8 @@ Settings getSettings(juce::AudioProcessorValueTreeState& apvts);
 /**
 */
 class SimpleRoomReverbAudioProcessor  : public juce::AudioProcessor
+                                      , private juce::AudioProcessorValueTreeState::Listener
+                                      , private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -45,6 +49,11 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    
+    bool supportsDoublePrecisionProcessing() const override;
+    
+    void setNonRealtime (bool isNonRealtime) noexcept override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -73,10 +82,36 @@ public:
     
     juce::AudioProcessorValueTreeState& getPluginState();
     
+    // Editor side only. Copies the latest telemetry and returns true if it is new since last time.
+    bool pullTelemetry (Telemetry& dest) noexcept;
+    
+    // Mono wet signal for the editor's analyser. The audio thread only feeds it while it is active,
+    // so with the editor closed it costs nothing.
+    SpscRingBuffer<float>& getWetTap() noexcept { return wetTap; }
+    void setWetTapActive (bool shouldBeActive) noexcept { wetTapActive.store (shouldBeActive); }
+    
+    // Message thread only. Follows the parameters and the sample rate.
+    const DecayEstimate& getDecayEstimate() const noexcept { return decayEstimate; }
+    
+    // Message thread only. Saves the current sound as a user program and switches to it.
+    bool saveUserProgram (const juce::String& name);
+    
+    // Message thread only. Renders the current sound to a WAV impulse response in the background,
+    // returns false while the last one is still rendering.
+    bool exportImpulseResponse (const juce::File& file);
+    const IrExporter& getIrExporter() const noexcept { return irExporter; }
+    
+    // Message thread only. With both slots stored, the morph parameter blends between them.
+    void captureSnapshot (SnapshotMorph::Slot slot);
+    void clearSnapshots();
+    bool hasSnapshot (SnapshotMorph::Slot slot) const { return snapshotMorph.hasSnapshot (slot); }
+    
 private:
     //==============================================================================
     juce::AudioProcessorValueTreeState apvts;
     
+    ProgramBank programBank { apvts };
+    
     juce::AudioParameterFloat* size { nullptr };
     juce::AudioParameterFloat* damp { nullptr };
     juce::AudioParameterFloat* width { nullptr };
@@ -86,21 +121,79 @@ private:
     juce::AudioParameterFloat* highPass { nullptr };
     juce::AudioParameterBool* bypass { nullptr };
     
-    bool firstTimeInitializing;
+    bool firstTimeInitializing { true };
     
     bool isBypassed();
-    void updateFilters();
-    void updateReverbParameters();
+    
+    template <typename SampleType>
+    void prepareEngine (Engine<SampleType>& engine, const juce::dsp::ProcessSpec& spec);
+    
+    template <typename SampleType>
+    void process (juce::AudioBuffer<SampleType>& buffer, Engine<SampleType>& engine);
+    
+    Settings getTargetSettings() noexcept;
+    double getHostBpm() noexcept;
+    float getMorphPosition() const noexcept;
+    void applyPendingProgram();
+    
+    void publishTelemetry (bool tailIsSleeping) noexcept;
+    
+    // Everything the decay estimate depends on.
+    static constexpr const char* decayParameters[] { Parameters::size, Parameters::damp, Parameters::freeze,
+                                                     Parameters::decayMode, Parameters::decayTime, Parameters::dampFreq,
+                                                     Parameters::lowDecay, Parameters::midDecay, Parameters::highDecay,
+                                                     Parameters::lowCrossover, Parameters::highCrossover,
+                                                     Parameters::morph };
+    
+    void parameterChanged (const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+    void updateDecayEstimate();
+    
+    // Set by a change of the core mode, which needs the engine prepared again.
+    std::atomic<bool> coreModeChanged { false };
+    
+    // A program change reaches the audio thread straight away as a pointer to its precomputed
+    // snapshot, and the next block ramps to it. The parameters are brought into line on the
+    // message thread afterwards, and until then the program's snapshot stands in for them.
+    std::atomic<int> currentProgram { 0 };
+    std::atomic<const ProgramBank::Program*> pendingProgram { nullptr };
+    
+    SnapshotMorph snapshotMorph;
+    
+    // The room's reflection taps, worked out in the background. The copy here is audio thread side.
+    RoomModel roomModel { apvts };
+    ReflectionTaps reflectionTaps;
+    
+    IrExporter irExporter;
     
     float lastSampleRate;
     
-    Settings settings;
+    // Written by the audio thread. Kept for blocks the host sends without a tempo.
+    std::atomic<double> hostBpm { 120.0 };
+    
+    // Audio thread. What the DSP currently runs with, stepped at micro-block boundaries.
+    SettingsRamp settingsRamp;
+    
+    Engine<float> floatEngine;
+    Engine<double> doubleEngine;
+    
+    static constexpr int minForkJoinBlockSize { 4096 };
+    juce::SharedResourcePointer<ForkJoinPool> forkJoinPool;
     
-    juce::dsp::Reverb reverb;
-    juce::dsp::Reverb::Parameters reverbParameters;
+    // Audio thread to editor. Anything richer than parameters goes through lock-free channels
+    // like this one, never through a lock the audio thread could wait on.
+    juce::AudioProcessLoadMeasurer loadMeasurer;
+    LevelMeter inputMeter;
+    LevelMeter wetMeter;
+    LevelMeter outputMeter;
+    TripleBuffer<Telemetry> telemetry;
+    SpscRingBuffer<float> wetTap { 32768 };
+    std::atomic<bool> wetTapActive { false };
     
-    juce::dsp::StateVariableTPTFilter<float> lowPassFilter;
-    juce::dsp::StateVariableTPTFilter<float> highPassFilter;
+    // Estimated on the message thread whenever a parameter it depends on moves. The host can ask
+    // for the tail length from any thread, so that goes through an atomic.
+    DecayEstimate decayEstimate;
+    std::atomic<double> tailLengthSeconds { 0.0 };
     
     juce::UndoManager undoManager;
     
@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    ProgramBank.cpp
+    Created: 19 Oct 2026 9:05:37pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "ProgramBank.h"
+
+namespace
+{
+    struct FactoryProgram
+    {
+        const char* name;
+        float size, damp, width, mix;
+        bool decayMode;
+        float decayTime, dampFreq;
+        float lowPass, highPass;
+    };
+
+    // The first one matches the parameter defaults, so a fresh instance is on a real program.
+    constexpr FactoryProgram factoryPrograms[]
+    {
+        { "Default",        50.0f, 50.0f,  50.0f, 50.0f, false,  2.0f, 5000.0f, 20000.0f,  20.0f },
+        { "Small Room",     30.0f, 60.0f,  60.0f, 25.0f, false,  2.0f, 5000.0f, 12000.0f, 120.0f },
+        { "Vocal Plate",    65.0f, 25.0f, 100.0f, 30.0f, false,  2.0f, 5000.0f, 14000.0f, 180.0f },
+        { "Dark Chamber",   70.0f, 85.0f,  70.0f, 35.0f, false,  2.0f, 5000.0f,  6000.0f,  60.0f },
+        { "Hall 3.5 s",     50.0f, 50.0f, 100.0f, 35.0f, true,   3.5f, 4500.0f, 16000.0f,  40.0f },
+        { "Cathedral 8 s",  50.0f, 50.0f, 100.0f, 40.0f, true,   8.0f, 3000.0f, 12000.0f,  30.0f },
+        { "Ambient Wash",   50.0f, 50.0f, 100.0f, 55.0f, true,  15.0f, 6000.0f, 14000.0f, 150.0f },
+    };
+
+    constexpr auto programTag { "Program" };
+    constexpr auto parameterTag { "Parameter" };
+}
+
+ProgramBank::ProgramBank (juce::AudioProcessorValueTreeState& s)
+    : apvts (s)
+{
+    rescan();
+}
+
+int ProgramBank::getNumPrograms() const noexcept
+{
+    return static_cast<int> (programs.load()->size());
+}
+
+const ProgramBank::Program* ProgramBank::getProgram (int index) const noexcept
+{
+    const auto* list = programs.load();
+    return juce::isPositiveAndBelow (index, static_cast<int> (list->size())) ? &(*list)[static_cast<size_t> (index)] : nullptr;
+}
+
+void ProgramBank::rescan()
+{
+    auto list = std::make_unique<ProgramList>();
+
+    for (const auto& f : factoryPrograms)
+    {
+        list->push_back (makeProgram (f.name, {}, { { Parameters::size, f.size },
+                                                    { Parameters::damp, f.damp },
+                                                    { Parameters::width, f.width },
+                                                    { Parameters::mix, f.mix },
+                                                    { Parameters::decayMode, f.decayMode ? 1.0f : 0.0f },
+                                                    { Parameters::decayTime, f.decayTime },
+                                                    { Parameters::dampFreq, f.dampFreq },
+                                                    { Parameters::lowPass, f.lowPass },
+                                                    { Parameters::highPass, f.highPass } }));
+    }
+
+    auto files = getUserFolder().findChildFiles (juce::File::findFiles, false, "*.xml");
+    files.sort();
+
+    for (const auto& file : files)
+    {
+        const auto xml = juce::parseXMLIfTagMatches (file, programTag);
+
+        if (xml == nullptr)
+            continue;
+
+        std::vector<std::pair<juce::String, float>> values;
+
+        for (auto* p : xml->getChildWithTagNameIterator (parameterTag))
+            values.emplace_back (p->getStringAttribute ("id"), static_cast<float> (p->getDoubleAttribute ("value")));
+
+        list->push_back (makeProgram (xml->getStringAttribute ("name", file.getFileNameWithoutExtension()), file, std::move (values)));
+    }
+
+    programs.store (list.get());
+    lists.push_back (std::move (list));
+}
+
+int ProgramBank::saveUserProgram (const juce::String& name)
+{
+    juce::XmlElement xml (programTag);
+    xml.setAttribute ("name", name);
+
+    for (auto* id : programParameters)
+    {
+        auto* p = xml.createNewChildElement (parameterTag);
+        p->setAttribute ("id", id);
+        p->setAttribute ("value", apvts.getRawParameterValue (id)->load());
+    }
+
+    const auto folder = getUserFolder();
+    const auto file = folder.getChildFile (juce::File::createLegalFileName (name) + ".xml");
+
+    if (! folder.createDirectory() || ! xml.writeTo (file))
+        return -1;
+
+    rescan();
+
+    for (int i = 0; i < getNumPrograms(); ++i)
+        if (getProgram (i)->file == file)
+            return i;
+
+    return -1;
+}
+
+juce::File ProgramBank::getUserFolder()
+{
+    return juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+               .getChildFile ("SimpleRoomReverb")
+               .getChildFile ("Programs");
+}
+
+ProgramBank::Program ProgramBank::makeProgram (const juce::String& name, const juce::File& file, std::vector<std::pair<juce::String, float>> values) const
+{
+    Program program { name, file, {}, {} };
+
+    // Anything the program leaves out goes back to its default, and values out of range are
+    // clamped the way the parameter itself would.
+    for (auto* id : programParameters)
+    {
+        auto* parameter = apvts.getParameter (id);
+        auto value = parameter->convertFrom0to1 (parameter->getDefaultValue());
+
+        for (const auto& [valueId, v] : values)
+            if (valueId == id)
+                value = parameter->convertFrom0to1 (parameter->convertTo0to1 (v));
+
+        program.values.emplace_back (id, value);
+    }
+
+    program.settings = makeSettings ([&program, this] (const char* id)
+    {
+        for (const auto& [valueId, v] : program.values)
+            if (valueId == id)
+                return v;
+
+        auto* parameter = apvts.getParameter (id);
+        return parameter->convertFrom0to1 (parameter->getDefaultValue());
+    });
+
+    return program;
+}
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    ProgramBank.h
+    Created: 19 Oct 2026 9:05:37pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "Settings.h"
+
+// Factory programs followed by the user's own, which live as one XML file each in getUserFolder().
+// Everything a program change needs on the audio thread, the DSP snapshot in particular, is worked
+// out when the bank is loaded, so switching is just picking up a pointer.
+class ProgramBank
+{
+public:
+    struct Program
+    {
+        juce::String name;
+        juce::File file;    // empty for factory programs
+
+        // Plain values in the units the host sees, for writing back into the parameters.
+        std::vector<std::pair<juce::String, float>> values;
+
+        Settings settings;
+    };
+
+    // The parameters a program stores. Bypass, the core mode and the duck key belong to the
+    // session instead.
+    static constexpr const char* programParameters[] { Parameters::size, Parameters::damp, Parameters::width, Parameters::mix,
+                                                       Parameters::freeze, Parameters::freezeMode,
+                                                       Parameters::decayMode, Parameters::decayTime, Parameters::dampFreq,
+                                                       Parameters::lowDecay, Parameters::midDecay, Parameters::highDecay,
+                                                       Parameters::lowCrossover, Parameters::highCrossover,
+                                                       Parameters::early, Parameters::roomWidth, Parameters::roomDepth, Parameters::roomHeight,
+                                                       Parameters::sourceX, Parameters::sourceY, Parameters::listenerX, Parameters::listenerY,
+                                                       Parameters::absorption,
+                                                       Parameters::duckThreshold, Parameters::duckDepth, Parameters::duckAttack, Parameters::duckRelease,
+                                                       Parameters::gate, Parameters::gateThreshold, Parameters::gateHold, Parameters::gateRelease,
+                                                       Parameters::gateSync, Parameters::gateDivision,
+                                                       Parameters::lowPass, Parameters::highPass };
+
+    explicit ProgramBank (juce::AudioProcessorValueTreeState& apvts);
+
+    // Safe from any thread. A program stays valid for as long as the bank exists.
+    int getNumPrograms() const noexcept;
+    const Program* getProgram (int index) const noexcept;
+
+    // Message thread only. Reloads the user programs, for instance after one was saved.
+    void rescan();
+
+    // Message thread only. Stores the current parameter values as a user program and returns its
+    // index, or -1 if the file couldn't be written.
+    int saveUserProgram (const juce::String& name);
+
+    static juce::File getUserFolder();
+
+private:
+    using ProgramList = std::vector<Program>;
+
+    Program makeProgram (const juce::String& name, const juce::File& file, std::vector<std::pair<juce::String, float>> values) const;
+
+    juce::AudioProcessorValueTreeState& apvts;
+
+    // A rescan publishes a whole new list. The old ones are kept, the audio thread may still be
+    // ramping towards one of their programs, and they are tiny next to the delay lines.
+    std::atomic<const ProgramList*> programs { nullptr };
+    std::vector<std::unique_ptr<ProgramList>> lists;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProgramBank)
+};
@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    RoomModel.cpp
+    Created: 19 Oct 2026 11:02:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "RoomModel.h"
+
+RoomModel::RoomModel (juce::AudioProcessorValueTreeState& s)
+    : apvts (s)
+{
+    for (auto* id : geometryParameters)
+        apvts.addParameterListener (id, this);
+
+    // The first taps are for the room the parameters start out with.
+    handleAsyncUpdate();
+}
+
+RoomModel::~RoomModel()
+{
+    for (auto* id : geometryParameters)
+        apvts.removeParameterListener (id, this);
+
+    cancelPendingUpdate();
+
+    // Waits for an update that is already running to finish.
+    updates.cancel();
+}
+
+void RoomModel::parameterChanged (const juce::String& parameterID, float newValue)
+{
+    juce::ignoreUnused (parameterID, newValue);
+    isOutOfDate = true;
+    triggerAsyncUpdate();
+}
+
+void RoomModel::handleAsyncUpdate()
+{
+    // A queued update picks up every change made before it runs, so one is enough.
+    if (isQueued.exchange (true))
+        return;
+
+    // The queue is only full when other instances have swamped it. The next change tries again.
+    if (! updates.submit (WorkerPool::Priority::normal, [this] { return update(); }))
+        isQueued = false;
+}
+
+int RoomModel::update()
+{
+    if (isOutOfDate.exchange (false))
+        taps.write (computeImageSources (getGeometry()));
+
+    // Only one update may be around at a time, since the taps have a single writer. A change made
+    // while this ran is picked up by running again, unless a new update got queued first.
+    isQueued = false;
+
+    if (isOutOfDate.load() && ! isQueued.exchange (true))
+        return 0;
+
+    return WorkerPool::done;
+}
+
+RoomGeometry RoomModel::getGeometry() const noexcept
+{
+    auto valueOf = [this] (const char* id) { return apvts.getRawParameterValue (id)->load(); };
+
+    RoomGeometry room;
+    room.width = valueOf (Parameters::roomWidth);
+    room.depth = valueOf (Parameters::roomDepth);
+    room.height = valueOf (Parameters::roomHeight);
+    room.sourceX = valueOf (Parameters::sourceX) * 0.01f;
+    room.sourceY = valueOf (Parameters::sourceY) * 0.01f;
+    room.listenerX = valueOf (Parameters::listenerX) * 0.01f;
+    room.listenerY = valueOf (Parameters::listenerY) * 0.01f;
+    room.absorption = valueOf (Parameters::absorption) * 0.01f;
+
+    return room;
+}
@@ -0,0 +1,59 @@
+/*
+  ==============================================================================
+
+    RoomModel.h
+    Created: 19 Oct 2026 11:02:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include "Parameters.h"
+#include "./Concurrency/TripleBuffer.h"
+#include "./Concurrency/WorkerPool.h"
+#include "./Dsp/ImageSource.h"
+
+// Keeps the early reflection taps in line with the room parameters. A change only marks the taps
+// out of date and posts a message, which is safe from the audio thread; the message thread then
+// queues a task that works them out again on the shared background workers and hands them to the
+// audio thread when ready. Nothing is computed while the room stays put.
+class RoomModel final : private juce::AudioProcessorValueTreeState::Listener
+                      , private juce::AsyncUpdater
+{
+public:
+    static constexpr const char* geometryParameters[] { Parameters::roomWidth, Parameters::roomDepth, Parameters::roomHeight,
+                                                        Parameters::sourceX, Parameters::sourceY,
+                                                        Parameters::listenerX, Parameters::listenerY,
+                                                        Parameters::absorption };
+
+    explicit RoomModel (juce::AudioProcessorValueTreeState& apvts);
+    ~RoomModel() override;
+
+    // Audio thread, or anywhere it isn't running. Copies the latest taps and returns true if they
+    // are new since last time.
+    bool pullTaps (ReflectionTaps& dest) noexcept { return taps.read (dest); }
+
+    // Any thread. The room as the parameters currently describe it.
+    RoomGeometry getGeometry() const noexcept;
+
+private:
+    void parameterChanged (const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+
+    // Background worker.
+    int update();
+
+    juce::AudioProcessorValueTreeState& apvts;
+
+    std::atomic<bool> isOutOfDate { true };
+    std::atomic<bool> isQueued { false };
+    TripleBuffer<ReflectionTaps> taps;
+
+    juce::SharedResourcePointer<WorkerPool> workers;
+    WorkerPool::Token updates { *workers };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RoomModel)
+};
@@ -0,0 +1,128 @@
+/*
+  ==============================================================================
+
+    Settings.cpp
+    Created: 19 Oct 2026 2:48:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Settings.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+bool operator== (const Settings& a, const Settings& b) noexcept
+{
+    return a.size == b.size
+        && a.damp == b.damp
+        && a.width == b.width
+        && a.wetLevel == b.wetLevel
+        && a.dryLevel == b.dryLevel
+        && a.freeze == b.freeze
+        && a.freezeMode == b.freezeMode
+        && a.decayMode == b.decayMode
+        && a.decayTime == b.decayTime
+        && a.dampFreq == b.dampFreq
+        && a.lowDecay == b.lowDecay
+        && a.midDecay == b.midDecay
+        && a.highDecay == b.highDecay
+        && a.lowCrossover == b.lowCrossover
+        && a.highCrossover == b.highCrossover
+        && a.earlyLevel == b.earlyLevel
+        && a.lowPassFreq == b.lowPassFreq
+        && a.highPassFreq == b.highPassFreq
+        && a.duckThreshold == b.duckThreshold
+        && a.duckDepth == b.duckDepth
+        && a.duckAttack == b.duckAttack
+        && a.duckRelease == b.duckRelease
+        && a.duckSidechain == b.duckSidechain
+        && a.gate == b.gate
+        && a.gateThreshold == b.gateThreshold
+        && a.gateHold == b.gateHold
+        && a.gateRelease == b.gateRelease
+        && a.gateSync == b.gateSync
+        && a.gateDivision == b.gateDivision
+        && a.bypass == b.bypass;
+}
+
+bool operator!= (const Settings& a, const Settings& b) noexcept
+{
+    return ! (a == b);
+}
+
+Settings interpolateSettings (const Settings& from, const Settings& to, float proportion)
+{
+    if (proportion >= 1.0f)
+        return to;
+    
+    auto lerp = [proportion] (float a, float b) { return a + (b - a) * proportion; };
+    
+    // Frequencies are ramped on a log scale so a sweep moves evenly through the octaves.
+    auto logLerp = [proportion] (float a, float b) { return a * std::pow (b / a, proportion); };
+    
+    Settings settings { to };
+    settings.size = lerp (from.size, to.size);
+    settings.damp = lerp (from.damp, to.damp);
+    settings.width = lerp (from.width, to.width);
+    settings.wetLevel = lerp (from.wetLevel, to.wetLevel);
+    settings.dryLevel = 1.0f - settings.wetLevel;
+    settings.earlyLevel = lerp (from.earlyLevel, to.earlyLevel);
+    settings.decayTime = logLerp (from.decayTime, to.decayTime);
+    settings.dampFreq = logLerp (from.dampFreq, to.dampFreq);
+    settings.lowDecay = logLerp (from.lowDecay, to.lowDecay);
+    settings.midDecay = logLerp (from.midDecay, to.midDecay);
+    settings.highDecay = logLerp (from.highDecay, to.highDecay);
+    settings.lowCrossover = logLerp (from.lowCrossover, to.lowCrossover);
+    settings.highCrossover = logLerp (from.highCrossover, to.highCrossover);
+    settings.lowPassFreq = logLerp (from.lowPassFreq, to.lowPassFreq);
+    settings.highPassFreq = logLerp (from.highPassFreq, to.highPassFreq);
+    settings.duckThreshold = lerp (from.duckThreshold, to.duckThreshold);
+    settings.duckDepth = lerp (from.duckDepth, to.duckDepth);
+    settings.duckAttack = logLerp (from.duckAttack, to.duckAttack);
+    settings.duckRelease = logLerp (from.duckRelease, to.duckRelease);
+    settings.gateThreshold = lerp (from.gateThreshold, to.gateThreshold);
+    settings.gateHold = logLerp (from.gateHold, to.gateHold);
+    settings.gateRelease = logLerp (from.gateRelease, to.gateRelease);
+    
+    return settings;
+}
+
+//==============================================================================
+void SettingsRamp::reset (const Settings& newSettings) noexcept
+{
+    start = current = target = newSettings;
+    step = numSteps;
+}
+
+void SettingsRamp::setTarget (const Settings& newTarget) noexcept
+{
+    if (newTarget == target)
+        return;
+    
+    start = current;
+    target = newTarget;
+    step = 0;
+}
+
+const Settings& SettingsRamp::next() noexcept
+{
+    if (step < numSteps)
+    {
+        ++step;
+        current = interpolateSettings (start, target, static_cast<float> (step) / static_cast<float> (numSteps));
+    }
+    
+    return current;
+}
+
+//==============================================================================
+float gateHoldForTempo (int division, double bpm)
+{
+    // In quarter notes, which is what the host counts its tempo in.
+    constexpr double noteLengths[] { 0.125, 0.25, 0.5, 1.0, 2.0, 4.0 };
+    
+    const auto note = noteLengths[std::clamp (division, 0, static_cast<int> (std::size (noteLengths)) - 1)];
+    return static_cast<float> (note * 60000.0 / std::max (1.0, bpm));
+}
@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+
+    Settings.h
+    Created: 19 Oct 2026 2:48:51pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "Parameters.h"
+
+// One snapshot of the plugin parameters, already scaled for the DSP.
+struct Settings {
+    float size { 0 };
+    float damp { 0 };
+    float width { 0 };
+    float wetLevel { 0 };
+    float dryLevel { 0 };
+    bool freeze { false };
+    int freezeMode { 0 };
+    bool decayMode { false };   // decayTime and dampFreq replace size and damp
+    float decayTime { 0 };
+    float dampFreq { 0 };
+    float lowDecay { 1 };       // how many times as long each band rings
+    float midDecay { 1 };
+    float highDecay { 1 };
+    float lowCrossover { 0 };   // Hz
+    float highCrossover { 0 };
+    float earlyLevel { 0 };     // the room geometry reaches the DSP separately, see RoomModel
+    float lowPassFreq { 0 };
+    float highPassFreq { 0 };
+    float duckThreshold { 0 };  // dB
+    float duckDepth { 0 };      // dB, 0 turns ducking off
+    float duckAttack { 0 };     // ms
+    float duckRelease { 0 };
+    bool duckSidechain { false };   // the key is the sidechain input instead of the main one
+    bool gate { false };
+    float gateThreshold { 0 };  // dB
+    float gateHold { 0 };       // ms, replaced by the note length while synced
+    float gateRelease { 0 };    // ms
+    bool gateSync { false };    // the hold is a note length at the host tempo
+    int gateDivision { 0 };     // which note, see gateHoldForTempo()
+    bool bypass { false };
+};
+
+bool operator== (const Settings& a, const Settings& b) noexcept;
+bool operator!= (const Settings& a, const Settings& b) noexcept;
+
+// The continuous values `proportion` of the way from one snapshot to another. Switches (freeze,
+// bypass, the duck key, the gate) take the new value.
+Settings interpolateSettings (const Settings& from, const Settings& to, float proportion);
+
+// Host automation is only delivered once per block, so the snapshot the DSP sees moves towards
+// the latest target by one step per micro-block instead of jumping. The ramp takes the same number
+// of micro-blocks whatever the host's buffer size, so a change that arrives on the same sample
+// renders the same at every buffer size.
+//
+// The price is latency. Every change takes numSteps micro-blocks to land, and a new target
+// restarts the ramp from wherever it has got to. Automation that moves more often than that, as a
+// mix tied tightly to picture does, trails the lane by up to numSteps micro-blocks and cuts the
+// corners between its points rather than reaching each one.
+class SettingsRamp
+{
+public:
+    // 512 samples, about 10 ms at 48 kHz (11.6 ms at 44.1 kHz): the most a change lags behind.
+    static constexpr int numSteps { 16 };
+
+    // Jumps straight to `newSettings`.
+    void reset (const Settings& newSettings) noexcept;
+
+    // A target that differs from the current one starts a new ramp from wherever this is now.
+    void setTarget (const Settings& newTarget) noexcept;
+
+    // Steps on by a micro-block and returns the snapshot for it.
+    const Settings& next() noexcept;
+
+    const Settings& getCurrent() const noexcept { return current; }
+
+private:
+    Settings start, current, target;
+    int step { numSteps };
+};
+
+// The gate's hold in ms for a note of `division` (a 32nd up to a whole note) at `bpm`.
+float gateHoldForTempo (int division, double bpm);
+
+// Builds a snapshot from plain parameter values, as the host sees them. `valueOf` takes a
+// parameter ID and returns its value.
+template <typename ValueOf>
+Settings makeSettings (ValueOf&& valueOf)
+{
+    Settings settings;
+    
+    // Multiply by 0.01 for scaling refactor as juce::dsp::Reverb::Parameters expects a value between 0.0 and 1.0.
+    settings.size = valueOf (Parameters::size) * 0.01f;
+    settings.damp = valueOf (Parameters::damp) * 0.01f;
+    settings.width = valueOf (Parameters::width) * 0.01f;
+    settings.wetLevel = valueOf (Parameters::mix) * 0.01f;
+    settings.dryLevel = 1.0f - settings.wetLevel;
+    settings.freeze = valueOf (Parameters::freeze) >= 0.5f;
+    settings.freezeMode = static_cast<int> (valueOf (Parameters::freezeMode));
+    settings.decayMode = valueOf (Parameters::decayMode) >= 0.5f;
+    settings.decayTime = valueOf (Parameters::decayTime);
+    settings.dampFreq = valueOf (Parameters::dampFreq);
+    settings.lowDecay = valueOf (Parameters::lowDecay);
+    settings.midDecay = valueOf (Parameters::midDecay);
+    settings.highDecay = valueOf (Parameters::highDecay);
+    settings.lowCrossover = valueOf (Parameters::lowCrossover);
+    settings.highCrossover = valueOf (Parameters::highCrossover);
+    settings.earlyLevel = valueOf (Parameters::early) * 0.01f;
+    settings.lowPassFreq = valueOf (Parameters::lowPass);
+    settings.highPassFreq = valueOf (Parameters::highPass);
+    settings.duckThreshold = valueOf (Parameters::duckThreshold);
+    settings.duckDepth = valueOf (Parameters::duckDepth);
+    settings.duckAttack = valueOf (Parameters::duckAttack);
+    settings.duckRelease = valueOf (Parameters::duckRelease);
+    settings.duckSidechain = valueOf (Parameters::duckKey) >= 0.5f;
+    settings.gate = valueOf (Parameters::gate) >= 0.5f;
+    settings.gateThreshold = valueOf (Parameters::gateThreshold);
+    settings.gateHold = valueOf (Parameters::gateHold);
+    settings.gateRelease = valueOf (Parameters::gateRelease);
+    settings.gateSync = valueOf (Parameters::gateSync) >= 0.5f;
+    settings.gateDivision = static_cast<int> (valueOf (Parameters::gateDivision));
+    settings.bypass = valueOf (Parameters::bypass) >= 0.5f;
+    
+    return settings;
+}
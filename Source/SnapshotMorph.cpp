@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    SnapshotMorph.cpp
+    Created: 19 Oct 2026 10:17:42pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "SnapshotMorph.h"
+
+namespace
+{
+    const juce::Identifier snapshotsType { "Snapshots" };
+    const juce::Identifier slotIds[] { "A", "B" };
+}
+
+void SnapshotMorph::capture (Slot slot, juce::AudioProcessorValueTreeState& apvts)
+{
+    const auto index = static_cast<size_t> (slot);
+    const auto settings = makeSettings ([&apvts] (const char* id) { return apvts.getRawParameterValue (id)->load(); });
+
+    const std::lock_guard<std::mutex> sl (lock);
+    pack (settings, snapshots[index]);
+    stored[index] = true;
+    publish();
+}
+
+void SnapshotMorph::clear()
+{
+    const std::lock_guard<std::mutex> sl (lock);
+    stored[0] = stored[1] = false;
+    publish();
+}
+
+bool SnapshotMorph::hasSnapshot (Slot slot) const
+{
+    const std::lock_guard<std::mutex> sl (lock);
+    return stored[static_cast<size_t> (slot)];
+}
+
+void SnapshotMorph::applyForMessageThread (Settings& settings, float position) const
+{
+    const std::lock_guard<std::mutex> sl (lock);
+    applyBlend (makeBlend(), settings, position);
+}
+
+void SnapshotMorph::saveTo (juce::ValueTree& state) const
+{
+    state.removeChild (state.getChildWithName (snapshotsType), nullptr);
+
+    juce::ValueTree tree (snapshotsType);
+    const std::lock_guard<std::mutex> sl (lock);
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        if (! stored[i])
+            continue;
+
+        juce::Array<juce::var> values;
+
+        for (auto v : snapshots[i])
+            values.add (v);
+
+        tree.setProperty (slotIds[i], values, nullptr);
+    }
+
+    state.appendChild (tree, nullptr);
+}
+
+void SnapshotMorph::loadFrom (const juce::ValueTree& state)
+{
+    const auto tree = state.getChildWithName (snapshotsType);
+    const std::lock_guard<std::mutex> sl (lock);
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const auto* values = tree.getProperty (slotIds[i]).getArray();
+        stored[i] = values != nullptr && values->size() == numValues;
+
+        for (int v = 0; stored[i] && v < numValues; ++v)
+            snapshots[i][v] = static_cast<float> ((*values)[v]);
+    }
+
+    publish();
+}
+
+void SnapshotMorph::pack (const Settings& settings, float* values) noexcept
+{
+    values[sizeIndex] = settings.size;
+    values[dampIndex] = settings.damp;
+    values[widthIndex] = settings.width;
+    values[wetIndex] = settings.wetLevel;
+    values[decayTimeIndex] = std::log (settings.decayTime);
+    values[dampFreqIndex] = std::log (settings.dampFreq);
+    values[lowPassIndex] = std::log (settings.lowPassFreq);
+    values[highPassIndex] = std::log (settings.highPassFreq);
+}
+
+SnapshotMorph::Blend SnapshotMorph::makeBlend() const noexcept
+{
+    Blend newBlend;
+    newBlend.active = stored[0] && stored[1];
+
+    for (int v = 0; v < numValues; ++v)
+    {
+        newBlend.start[v] = snapshots[0][v];
+        newBlend.delta[v] = snapshots[1][v] - snapshots[0][v];
+    }
+
+    return newBlend;
+}
+
+void SnapshotMorph::publish()
+{
+    blends.write (makeBlend());
+}
@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    SnapshotMorph.h
+    Created: 19 Oct 2026 10:17:42pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <mutex>
+#include "Settings.h"
+#include "./Concurrency/TripleBuffer.h"
+
+// Two stored sounds, A and B, and a blend between them. Once both are stored, the morph position
+// alone sets every continuous parameter, so one automation lane replaces several.
+//
+// The snapshots are packed into one array of DSP values with the frequencies and the decay time as
+// logarithms, so a blend is a single vector lerp and moves evenly through the octaves.
+class SnapshotMorph
+{
+public:
+    enum class Slot { a, b };
+
+    // Message thread. Stores the current parameter values in a slot.
+    void capture (Slot slot, juce::AudioProcessorValueTreeState& apvts);
+    void clear();
+
+    bool hasSnapshot (Slot slot) const;
+
+    // Audio thread. When both slots are stored, replaces the continuous fields of `settings` with
+    // the blend at `position`, from 0 (A) to 1 (B).
+    void apply (Settings& settings, float position) noexcept
+    {
+        blends.read (blend);
+        applyBlend (blend, settings, position);
+    }
+
+    // Message thread. The same as apply(), for anything that has to predict what the audio thread
+    // will do.
+    void applyForMessageThread (Settings& settings, float position) const;
+
+    // Kept in the plugin state as a child of the parameter tree.
+    void saveTo (juce::ValueTree& state) const;
+    void loadFrom (const juce::ValueTree& state);
+
+private:
+    enum
+    {
+        sizeIndex,
+        dampIndex,
+        widthIndex,
+        wetIndex,
+        decayTimeIndex,
+        dampFreqIndex,
+        lowPassIndex,
+        highPassIndex,
+        numValues
+    };
+
+    struct Blend
+    {
+        alignas (16) float start[numValues] {};
+        alignas (16) float delta[numValues] {};
+        bool active { false };
+    };
+
+    static void applyBlend (const Blend& blend, Settings& settings, float position) noexcept
+    {
+        if (! blend.active)
+            return;
+
+        alignas (16) float values[numValues];
+        juce::FloatVectorOperations::copy (values, blend.start, numValues);
+        juce::FloatVectorOperations::addWithMultiply (values, blend.delta, position, numValues);
+
+        settings.size = values[sizeIndex];
+        settings.damp = values[dampIndex];
+        settings.width = values[widthIndex];
+        settings.wetLevel = values[wetIndex];
+        settings.dryLevel = 1.0f - settings.wetLevel;
+        settings.decayTime = std::exp (values[decayTimeIndex]);
+        settings.dampFreq = std::exp (values[dampFreqIndex]);
+        settings.lowPassFreq = std::exp (values[lowPassIndex]);
+        settings.highPassFreq = std::exp (values[highPassIndex]);
+    }
+
+    static void pack (const Settings& settings, float* values) noexcept;
+
+    // Called with the lock held.
+    Blend makeBlend() const noexcept;
+
+    // Called with the lock held, which also keeps the triple buffer down to one writer at a time.
+    void publish();
+
+    // Message thread side, but the state can be saved and restored from other threads.
+    mutable std::mutex lock;
+    float snapshots[2][numValues] {};
+    bool stored[2] {};
+
+    TripleBuffer<Blend> blends;
+
+    // Audio thread side.
+    Blend blend;
+};
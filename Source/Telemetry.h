@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    Telemetry.h
+    Created: 19 Oct 2026 3:12:47pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+// Meter state for up to two channels, with the ballistics already applied on the audio thread so
+// a reader that skips a few updates still sees every peak.
+struct MeterReading
+{
+    float peak[2] {};
+    float rms[2] {};
+    int numChannels { 0 };
+};
+
+// What the audio thread reports to the editor after every block. It is copied through a triple
+// buffer, so it has to stay small and trivially copyable.
+struct Telemetry
+{
+    float cpuLoad { 0.0f };     // share of the block's time budget spent processing
+    int xRunCount { 0 };        // blocks that overran their budget since prepareToPlay
+    bool tailIsSleeping { false };
+
+    MeterReading input;
+    MeterReading wet;           // reverb only, before the dry signal and the filters
+    MeterReading output;
+};
@@ -23,6 +23,11 @@ BypassButton::BypassButton (juce::RangedAudioParameter& param, juce::UndoManager
 
 BypassButton::~BypassButton() = default;
 
+void BypassButton::refresh()
+{
+    paramAttachment.refresh();
+}
+
 void BypassButton::onClicked()
 {
     const bool newState = !state;
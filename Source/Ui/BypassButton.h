@@ -12,6 +12,7 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "ParameterLink.h"
 
 class BypassButton final : public juce::TextButton
 {
@@ -20,13 +21,16 @@ public:
     BypassButton(juce::RangedAudioParameter& param, juce::UndoManager* um = nullptr);
     ~BypassButton() override;
     
+    // Catches up with the parameter, if it changed. The editor calls this once a frame.
+    void refresh();
+    
 private:
     void updateState (bool newState);
     
     void onClicked();
     
     juce::RangedAudioParameter& audioParam;
-    juce::ParameterAttachment paramAttachment;
+    ParameterLink paramAttachment;
     bool state = false;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BypassButton)
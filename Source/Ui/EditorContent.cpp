@@ -10,42 +10,215 @@
 
 #include "EditorContent.h"
 #include "../Parameters.h"
+#include "UseColors.h"
 
 EditorContent::EditorContent (SimpleRoomReverbAudioProcessor& p, juce::UndoManager& um)
-    : apvts( p.getPluginState())
+    : processor (p)
+    , apvts( p.getPluginState())
     , sizeSlider(*apvts.getParameter(Parameters::size), &um)
     , dampSlider(*apvts.getParameter(Parameters::damp), &um)
+    , decayTimeSlider(*apvts.getParameter(Parameters::decayTime), &um)
+    , dampFreqSlider(*apvts.getParameter(Parameters::dampFreq), &um)
     , widthSlider(*apvts.getParameter(Parameters::width), &um)
     , mixSlider(*apvts.getParameter(Parameters::mix), &um)
     , lowPassSlider(*apvts.getParameter(Parameters::lowPass), &um)
     , highPassSlider(*apvts.getParameter(Parameters::highPass), &um)
-    , freezeButton(*apvts.getParameter(Parameters::freeze), &um)
+    , lowDecaySlider(*apvts.getParameter(Parameters::lowDecay), &um)
+    , lowCrossoverSlider(*apvts.getParameter(Parameters::lowCrossover), &um)
+    , midDecaySlider(*apvts.getParameter(Parameters::midDecay), &um)
+    , highCrossoverSlider(*apvts.getParameter(Parameters::highCrossover), &um)
+    , highDecaySlider(*apvts.getParameter(Parameters::highDecay), &um)
+    , earlySlider(*apvts.getParameter(Parameters::early), &um)
+    , roomWidthSlider(*apvts.getParameter(Parameters::roomWidth), &um)
+    , roomDepthSlider(*apvts.getParameter(Parameters::roomDepth), &um)
+    , roomHeightSlider(*apvts.getParameter(Parameters::roomHeight), &um)
+    , sourceXSlider(*apvts.getParameter(Parameters::sourceX), &um)
+    , sourceYSlider(*apvts.getParameter(Parameters::sourceY), &um)
+    , listenerXSlider(*apvts.getParameter(Parameters::listenerX), &um)
+    , listenerYSlider(*apvts.getParameter(Parameters::listenerY), &um)
+    , absorptionSlider(*apvts.getParameter(Parameters::absorption), &um)
+    , duckThresholdSlider(*apvts.getParameter(Parameters::duckThreshold), &um)
+    , duckDepthSlider(*apvts.getParameter(Parameters::duckDepth), &um)
+    , duckAttackSlider(*apvts.getParameter(Parameters::duckAttack), &um)
+    , duckReleaseSlider(*apvts.getParameter(Parameters::duckRelease), &um)
+    , duckKeyAttachment(*apvts.getParameter(Parameters::duckKey), duckKeyBox, &um)
+    , gateAttachment(*apvts.getParameter(Parameters::gate), gateButton, &um)
+    , gateThresholdSlider(*apvts.getParameter(Parameters::gateThreshold), &um)
+    , gateHoldSlider(*apvts.getParameter(Parameters::gateHold), &um)
+    , gateReleaseSlider(*apvts.getParameter(Parameters::gateRelease), &um)
+    , gateSyncAttachment(*apvts.getParameter(Parameters::gateSync), gateSyncButton, &um)
+    , gateDivisionAttachment(*apvts.getParameter(Parameters::gateDivision), gateDivisionBox, &um)
+    , freezeButton(*apvts.getParameter(Parameters::freeze), *apvts.getParameter(Parameters::freezeMode), &um)
+    , decayModeAttachment(*apvts.getParameter(Parameters::decayMode), decayModeButton, &um)
+    , coreModeAttachment(*apvts.getParameter(Parameters::coreMode), coreModeBox, &um)
+    , morphAttachment(*apvts.getParameter(Parameters::morph), morphSlider, &um)
     , bypassButton(*apvts.getParameter(Parameters::bypass), &um)
     , undoButton(um, UndoManagerButton::ActionType::Undo)
     , redoButton(um, UndoManagerButton::ActionType::Redo)
+    , tailAnalyser(p)
 {
     setWantsKeyboardFocus (true);
     setFocusContainerType(FocusContainerType::keyboardFocusContainer);
     
     sizeSlider.setExplicitFocusOrder(1);
     dampSlider.setExplicitFocusOrder(2);
+    decayTimeSlider.setExplicitFocusOrder(1);
+    dampFreqSlider.setExplicitFocusOrder(2);
     widthSlider.setExplicitFocusOrder(3);
     mixSlider.setExplicitFocusOrder(4);
     lowPassSlider.setExplicitFocusOrder(5);
     highPassSlider.setExplicitFocusOrder(6);
     
+    roomWidthSlider.setLabelText ("room W");
+    roomDepthSlider.setLabelText ("room D");
+    roomHeightSlider.setLabelText ("room H");
+    sourceXSlider.setLabelText ("source X");
+    sourceYSlider.setLabelText ("source Y");
+    listenerXSlider.setLabelText ("listen X");
+    listenerYSlider.setLabelText ("listen Y");
+    absorptionSlider.setLabelText ("absorb");
+    
+    auto focusOrder = 7;
+    
+    for (auto* s : { &earlySlider, &roomWidthSlider, &roomDepthSlider, &roomHeightSlider, &sourceXSlider,
+                     &sourceYSlider, &listenerXSlider, &listenerYSlider, &absorptionSlider })
+    {
+        s->setExplicitFocusOrder (focusOrder++);
+        addAndMakeVisible (s);
+    }
+    
+    duckThresholdSlider.setLabelText ("thresh");
+    duckDepthSlider.setLabelText ("duck");
+    duckAttackSlider.setLabelText ("attack");
+    duckReleaseSlider.setLabelText ("release");
+    
+    for (auto* s : { &duckThresholdSlider, &duckDepthSlider, &duckAttackSlider, &duckReleaseSlider })
+    {
+        s->setExplicitFocusOrder (focusOrder++);
+        addAndMakeVisible (s);
+    }
+    
+    if (auto* choice = dynamic_cast<juce::AudioParameterChoice*> (apvts.getParameter (Parameters::duckKey)))
+        duckKeyBox.addItemList (choice->choices, 1);
+    
+    duckKeyAttachment.sendInitialUpdate();
+    duckKeyBox.setTooltip ("What ducks the reverb. The sidechain has to be connected in the host.");
+    addAndMakeVisible (duckKeyBox);
+    
+    for (auto* b : { &gateButton, &gateSyncButton })
+    {
+        b->setColour (juce::ToggleButton::textColourId, UseColors::beige);
+        b->setColour (juce::ToggleButton::tickColourId, UseColors::yellow);
+        b->setExplicitFocusOrder (focusOrder++);
+        addAndMakeVisible (b);
+    }
+    
+    gateSyncButton.onStateChange = [this] { updateGateControls(); };
+    
+    gateThresholdSlider.setLabelText ("gate");
+    gateHoldSlider.setLabelText ("hold");
+    gateReleaseSlider.setLabelText ("release");
+    
+    for (auto* s : { &gateThresholdSlider, &gateHoldSlider, &gateReleaseSlider })
+    {
+        s->setExplicitFocusOrder (focusOrder++);
+        addAndMakeVisible (s);
+    }
+    
+    lowDecaySlider.setLabelText ("low x");
+    lowCrossoverSlider.setLabelText ("low/mid");
+    midDecaySlider.setLabelText ("mid x");
+    highCrossoverSlider.setLabelText ("mid/high");
+    highDecaySlider.setLabelText ("high x");
+    
+    for (auto* s : { &lowDecaySlider, &lowCrossoverSlider, &midDecaySlider, &highCrossoverSlider, &highDecaySlider })
+    {
+        s->setExplicitFocusOrder (focusOrder++);
+        addAndMakeVisible (s);
+    }
+    
+    if (auto* choice = dynamic_cast<juce::AudioParameterChoice*> (apvts.getParameter (Parameters::gateDivision)))
+        gateDivisionBox.addItemList (choice->choices, 1);
+    
+    gateDivisionAttachment.sendInitialUpdate();
+    gateDivisionBox.setTooltip ("The hold as a note at the host tempo");
+    addAndMakeVisible (gateDivisionBox);
+    updateGateControls();
+    
     addAndMakeVisible (sizeSlider);
     addAndMakeVisible (dampSlider);
+    addChildComponent (decayTimeSlider);
+    addChildComponent (dampFreqSlider);
     addAndMakeVisible (widthSlider);
     addAndMakeVisible (mixSlider);
     addAndMakeVisible (lowPassSlider);
     addAndMakeVisible (highPassSlider);
     
     addAndMakeVisible(freezeButton);
+    
+    decayModeButton.setColour (juce::ToggleButton::textColourId, UseColors::beige);
+    decayModeButton.setColour (juce::ToggleButton::tickColourId, UseColors::yellow);
+    decayModeButton.onStateChange = [this] { updateDecayControls(); };
+    addAndMakeVisible (decayModeButton);
+    updateDecayControls();
+    
+    // The attachment only selects items, so they are added here and the selection synced after.
+    if (auto* choice = dynamic_cast<juce::AudioParameterChoice*> (apvts.getParameter (Parameters::coreMode)))
+        coreModeBox.addItemList (choice->choices, 1);
+    
+    coreModeAttachment.sendInitialUpdate();
+    coreModeBox.setTooltip ("Delay tuning and the rate the reverb tank runs at");
+    addAndMakeVisible (coreModeBox);
+    
+    refreshPrograms();
+    programBox.onChange = [this] { processor.setCurrentProgram (programBox.getSelectedItemIndex()); };
+    addAndMakeVisible (programBox);
+    
+    saveProgramButton.onClick = [this] { saveProgram(); };
+    addAndMakeVisible (saveProgramButton);
+    
+    // Clicking A or B stores the current sound in that slot.
+    snapshotAButton.onClick = [this] { processor.captureSnapshot (SnapshotMorph::Slot::a); updateSnapshotButtons(); };
+    snapshotBButton.onClick = [this] { processor.captureSnapshot (SnapshotMorph::Slot::b); updateSnapshotButtons(); };
+    clearSnapshotsButton.onClick = [this] { processor.clearSnapshots(); updateSnapshotButtons(); };
+    
+    for (auto* b : { &snapshotAButton, &snapshotBButton })
+    {
+        b->setClickingTogglesState (false);
+        b->setColour (juce::TextButton::buttonOnColourId, UseColors::red);
+        addAndMakeVisible (b);
+    }
+    
+    addAndMakeVisible (clearSnapshotsButton);
+    updateSnapshotButtons();
+    
+    exportButton.setTooltip ("Render the current sound to a WAV impulse response");
+    exportButton.onClick = [this] { exportImpulseResponse(); };
+    addAndMakeVisible (exportButton);
+    
+    morphSlider.setColour (juce::Slider::textBoxTextColourId, UseColors::beige);
+    morphSlider.setTextBoxStyle (juce::Slider::TextBoxRight, false, 60, 24);
+    addAndMakeVisible (morphSlider);
     addAndMakeVisible(bypassButton);
     
     addAndMakeVisible(undoButton);
     addAndMakeVisible(redoButton);
+    
+    cpuLabel.setColour (juce::Label::textColourId, UseColors::beige);
+    cpuLabel.setJustificationType (juce::Justification::centredLeft);
+    addAndMakeVisible (cpuLabel);
+    
+    decayLabel.setColour (juce::Label::textColourId, UseColors::beige);
+    decayLabel.setJustificationType (juce::Justification::centredLeft);
+    addAndMakeVisible (decayLabel);
+    
+    addAndMakeVisible (inputMeter);
+    addAndMakeVisible (wetMeter);
+    addAndMakeVisible (outputMeter);
+    
+    addAndMakeVisible (tailAnalyser);
+    
+    startTimerHz (30);
 }
 
 void EditorContent::resized()
@@ -54,6 +227,8 @@ void EditorContent::resized()
     lowPassSlider.setBounds(baseDialBounds.withX (10));
     sizeSlider.setBounds(baseDialBounds.withX (108));
     dampSlider.setBounds(baseDialBounds.withX (202));
+    decayTimeSlider.setBounds(baseDialBounds.withX (108));
+    dampFreqSlider.setBounds(baseDialBounds.withX (202));
     widthSlider.setBounds(baseDialBounds.withX (402));
     mixSlider.setBounds(baseDialBounds.withX (500));
     highPassSlider.setBounds(baseDialBounds.withX (598));
@@ -66,13 +241,213 @@ void EditorContent::resized()
     undoButton.setBounds(bounds.getWidth() - 140, 10, 60, 24);
     redoButton.setBounds(bounds.getWidth() - 210, 10, 60, 24);
     
+    cpuLabel.setBounds (10, 10, 120, 24);
+    decayLabel.setBounds (130, 10, 160, 24);
+    decayModeButton.setBounds (290, 10, 95, 24);
+    coreModeBox.setBounds (390, 10, 85, 24);
+    
+    const juce::Rectangle baseMeterBounds {0, 196, 215, 28};
+    inputMeter.setBounds (baseMeterBounds.withX (10));
+    wetMeter.setBounds (baseMeterBounds.withX (237));
+    outputMeter.setBounds (baseMeterBounds.withX (464));
+    
+    tailAnalyser.setBounds (10, 236, 670, 154);
+    
+    programBox.setBounds (10, 398, 220, 24);
+    saveProgramButton.setBounds (235, 398, 60, 24);
+    
+    snapshotAButton.setBounds (315, 398, 30, 24);
+    snapshotBButton.setBounds (350, 398, 30, 24);
+    clearSnapshotsButton.setBounds (385, 398, 50, 24);
+    morphSlider.setBounds (440, 398, 165, 24);
+    exportButton.setBounds (610, 398, 70, 24);
+    
+    const juce::Rectangle baseRoomDialBounds {0, 430, 70, 84};
+    auto roomDialX = 10;
+    
+    for (auto* s : { &earlySlider, &roomWidthSlider, &roomDepthSlider, &roomHeightSlider, &sourceXSlider,
+                     &sourceYSlider, &listenerXSlider, &listenerYSlider, &absorptionSlider })
+    {
+        s->setBounds (baseRoomDialBounds.withX (roomDialX));
+        roomDialX += 75;
+    }
+    
+    const juce::Rectangle baseDuckDialBounds {0, 524, 70, 84};
+    duckThresholdSlider.setBounds (baseDuckDialBounds.withX (10));
+    duckDepthSlider.setBounds (baseDuckDialBounds.withX (85));
+    duckAttackSlider.setBounds (baseDuckDialBounds.withX (160));
+    duckReleaseSlider.setBounds (baseDuckDialBounds.withX (235));
+    duckKeyBox.setBounds (310, 554, 85, 24);
+    
+    gateButton.setBounds (400, 528, 60, 24);
+    gateSyncButton.setBounds (400, 556, 60, 24);
+    gateDivisionBox.setBounds (400, 584, 60, 24);
+    gateThresholdSlider.setBounds (baseDuckDialBounds.withX (465));
+    gateHoldSlider.setBounds (baseDuckDialBounds.withX (537));
+    gateReleaseSlider.setBounds (baseDuckDialBounds.withX (609));
+    
+    const juce::Rectangle baseBandDialBounds {0, 618, 70, 84};
+    auto bandDialX = 10;
+    
+    for (auto* s : { &lowDecaySlider, &lowCrossoverSlider, &midDecaySlider, &highCrossoverSlider, &highDecaySlider })
+    {
+        s->setBounds (baseBandDialBounds.withX (bandDialX));
+        bandDialX += 75;
+    }
+    
+}
+
+void EditorContent::timerCallback()
+{
+    tailAnalyser.refresh();
+    
+    // The host can change programs too.
+    if (programBox.getNumItems() != processor.getNumPrograms())
+        refreshPrograms();
+    
+    programBox.setSelectedItemIndex (processor.getCurrentProgram(), juce::dontSendNotification);
+    updateSnapshotButtons();
+    updateExportButton();
+    
+    const auto rt60 = processor.getDecayEstimate().rt60[DecayEstimate::midBand];
+    decayLabel.setText (std::isinf (rt60) ? juce::String ("RT60 frozen")
+                                          : "RT60 " + juce::String (rt60, 2) + " s @ 1 kHz",
+                        juce::dontSendNotification);
+    
+    Telemetry t;
+    
+    if (! processor.pullTelemetry (t))
+        return;
+    
+    cpuLabel.setText ("CPU " + juce::String (t.cpuLoad * 100.0f, 1) + " %", juce::dontSendNotification);
+    
+    inputMeter.setReading (t.input);
+    wetMeter.setReading (t.wet);
+    outputMeter.setReading (t.output);
+}
+
+void EditorContent::refreshParameters()
+{
+    for (auto* s : { &sizeSlider, &dampSlider, &decayTimeSlider, &dampFreqSlider, &widthSlider, &mixSlider,
+                     &lowPassSlider, &highPassSlider, &lowDecaySlider, &lowCrossoverSlider, &midDecaySlider,
+                     &highCrossoverSlider, &highDecaySlider, &earlySlider, &roomWidthSlider, &roomDepthSlider,
+                     &roomHeightSlider, &sourceXSlider, &sourceYSlider, &listenerXSlider, &listenerYSlider,
+                     &absorptionSlider, &duckThresholdSlider, &duckDepthSlider, &duckAttackSlider,
+                     &duckReleaseSlider, &gateThresholdSlider, &gateHoldSlider, &gateReleaseSlider })
+        s->refresh();
+    
+    freezeButton.refresh();
+    bypassButton.refresh();
+}
+
+void EditorContent::updateDecayControls()
+{
+    const auto useDecayTime = decayModeButton.getToggleState();
+    
+    sizeSlider.setVisible (! useDecayTime);
+    dampSlider.setVisible (! useDecayTime);
+    decayTimeSlider.setVisible (useDecayTime);
+    dampFreqSlider.setVisible (useDecayTime);
+}
+
+void EditorContent::updateGateControls()
+{
+    // While synced the hold comes from the note, so the time is greyed out.
+    const auto isSynced = gateSyncButton.getToggleState();
+    
+    gateHoldSlider.setEnabled (! isSynced);
+    gateDivisionBox.setEnabled (isSynced);
+}
+
+void EditorContent::refreshPrograms()
+{
+    programBox.clear (juce::dontSendNotification);
+    
+    for (int i = 0; i < processor.getNumPrograms(); ++i)
+        programBox.addItem (processor.getProgramName (i), i + 1);
+    
+    programBox.setSelectedItemIndex (processor.getCurrentProgram(), juce::dontSendNotification);
+}
+
+void EditorContent::saveProgram()
+{
+    auto* window = new juce::AlertWindow ("Save program", "Name of the new user program:", juce::MessageBoxIconType::NoIcon, this);
+    window->addTextEditor ("name", processor.getProgramName (processor.getCurrentProgram()));
+    window->addButton ("Save", 1, juce::KeyPress (juce::KeyPress::returnKey));
+    window->addButton ("Cancel", 0, juce::KeyPress (juce::KeyPress::escapeKey));
+    
+    juce::Component::SafePointer<EditorContent> safeThis (this);
+    
+    window->enterModalState (true, juce::ModalCallbackFunction::create ([safeThis, window] (int result)
+    {
+        const auto name = window->getTextEditorContents ("name").trim();
+        
+        if (safeThis == nullptr || result != 1 || name.isEmpty())
+            return;
+        
+        if (! safeThis->processor.saveUserProgram (name))
+            juce::AlertWindow::showMessageBoxAsync (juce::MessageBoxIconType::WarningIcon, "Save program",
+                                                    "Couldn't write to " + ProgramBank::getUserFolder().getFullPathName());
+        
+        safeThis->refreshPrograms();
+    }), true);
+}
+
+void EditorContent::updateSnapshotButtons()
+{
+    // A lit slot holds a snapshot. The morph only takes over once both do.
+    const auto hasA = processor.hasSnapshot (SnapshotMorph::Slot::a);
+    const auto hasB = processor.hasSnapshot (SnapshotMorph::Slot::b);
+    
+    snapshotAButton.setToggleState (hasA, juce::dontSendNotification);
+    snapshotBButton.setToggleState (hasB, juce::dontSendNotification);
+    morphSlider.setEnabled (hasA && hasB);
+}
+
+void EditorContent::exportImpulseResponse()
+{
+    const auto folder = juce::File::getSpecialLocation (juce::File::userDocumentsDirectory);
+    exportChooser = std::make_unique<juce::FileChooser> ("Export impulse response", folder.getChildFile ("SimpleRoomReverb IR.wav"), "*.wav");
+    
+    const auto flags = juce::FileBrowserComponent::saveMode
+                     | juce::FileBrowserComponent::canSelectFiles
+                     | juce::FileBrowserComponent::warnAboutOverwriting;
+    
+    juce::Component::SafePointer<EditorContent> safeThis (this);
+    
+    exportChooser->launchAsync (flags, [safeThis] (const juce::FileChooser& chooser)
+    {
+        const auto file = chooser.getResult();
+        
+        if (safeThis == nullptr || file == juce::File())
+            return;
+        
+        safeThis->processor.exportImpulseResponse (file.withFileExtension ("wav"));
+        safeThis->updateExportButton();
+    });
+}
+
+void EditorContent::updateExportButton()
+{
+    const auto& exporter = processor.getIrExporter();
+    const auto status = exporter.getStatus();
+    
+    // While rendering, the button shows how far it has got.
+    exportButton.setEnabled (status != IrExporter::Status::rendering);
+    exportButton.setButtonText (status == IrExporter::Status::rendering ? juce::String (juce::roundToInt (exporter.getProgress() * 100.0f)) + " %"
+                                                                        : juce::String ("Export IR"));
+    
+    if (status == IrExporter::Status::failed && lastExportStatus == IrExporter::Status::rendering)
+        juce::AlertWindow::showMessageBoxAsync (juce::MessageBoxIconType::WarningIcon, "Export IR", "Couldn't write the impulse response.");
+    
+    lastExportStatus = status;
 }
 
 bool EditorContent::keyPressed(const juce::KeyPress &k)
 {
     if (k.isKeyCode(juce::KeyPress::tabKey) && hasKeyboardFocus (false))
     {
-        sizeSlider.grabKeyboardFocus();
+        (sizeSlider.isVisible() ? sizeSlider : decayTimeSlider).grabKeyboardFocus();
         return true;
     }
     
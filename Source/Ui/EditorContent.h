@@ -14,11 +14,14 @@
 #include "UndoManagerButton.h"
 #include "BypassButton.h"
 #include "FreezeButton.h"
+#include "Meter.h"
 #include "Slider.h"
+#include "TailAnalyser.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 
 class EditorContent final : public juce::Component
+                          , private juce::Timer
 {
 public:
     EditorContent (SimpleRoomReverbAudioProcessor& p, juce::UndoManager& um);
@@ -27,21 +30,104 @@ public:
     bool keyPressed (const juce::KeyPress& k) override;
     
 private:
+    void timerCallback() override;
+    void refreshParameters();
+    void updateDecayControls();
+    void updateGateControls();
+    void refreshPrograms();
+    void saveProgram();
+    void updateSnapshotButtons();
+    void exportImpulseResponse();
+    void updateExportButton();
+    
+    SimpleRoomReverbAudioProcessor& processor;
     juce::AudioProcessorValueTreeState& apvts;
     
     Slider sizeSlider;
     Slider dampSlider;
+    Slider decayTimeSlider;
+    Slider dampFreqSlider;
     Slider widthSlider;
     Slider mixSlider;
     Slider lowPassSlider;
     Slider highPassSlider;
     
+    // Decay multipliers for the lows, mids and highs, with the crossovers between them.
+    Slider lowDecaySlider;
+    Slider lowCrossoverSlider;
+    Slider midDecaySlider;
+    Slider highCrossoverSlider;
+    Slider highDecaySlider;
+    
+    // Early reflections: their level and the room they come from.
+    Slider earlySlider;
+    Slider roomWidthSlider;
+    Slider roomDepthSlider;
+    Slider roomHeightSlider;
+    Slider sourceXSlider;
+    Slider sourceYSlider;
+    Slider listenerXSlider;
+    Slider listenerYSlider;
+    Slider absorptionSlider;
+    
+    // Ducking of the wet signal by the main or the sidechain input.
+    Slider duckThresholdSlider;
+    Slider duckDepthSlider;
+    Slider duckAttackSlider;
+    Slider duckReleaseSlider;
+    juce::ComboBox duckKeyBox;
+    juce::ComboBoxParameterAttachment duckKeyAttachment;
+    
+    // Gating of the wet signal, with the hold either in ms or as a note at the host tempo.
+    juce::ToggleButton gateButton { "Gate" };
+    juce::ButtonParameterAttachment gateAttachment;
+    Slider gateThresholdSlider;
+    Slider gateHoldSlider;
+    Slider gateReleaseSlider;
+    juce::ToggleButton gateSyncButton { "Sync" };
+    juce::ButtonParameterAttachment gateSyncAttachment;
+    juce::ComboBox gateDivisionBox;
+    juce::ComboBoxParameterAttachment gateDivisionAttachment;
+    
     FreezeButton freezeButton;
     
+    // Swaps size and damp for decay time and damping frequency.
+    juce::ToggleButton decayModeButton { "RT60 mode" };
+    juce::ButtonParameterAttachment decayModeAttachment;
+    
+    juce::ComboBox coreModeBox;
+    juce::ComboBoxParameterAttachment coreModeAttachment;
+    
+    juce::ComboBox programBox;
+    juce::TextButton saveProgramButton { "Save" };
+    
+    juce::TextButton exportButton { "Export IR" };
+    std::unique_ptr<juce::FileChooser> exportChooser;
+    IrExporter::Status lastExportStatus { IrExporter::Status::idle };
+    
+    juce::TextButton snapshotAButton { "A" };
+    juce::TextButton snapshotBButton { "B" };
+    juce::TextButton clearSnapshotsButton { "Clear" };
+    juce::Slider morphSlider { juce::Slider::LinearHorizontal, juce::Slider::TextBoxRight };
+    juce::SliderParameterAttachment morphAttachment;
+    
     BypassButton bypassButton;
     
     UndoManagerButton undoButton;
     UndoManagerButton redoButton;
+    
+    Meter inputMeter { "IN" };
+    Meter wetMeter { "WET" };
+    Meter outputMeter { "OUT" };
+    
+    TailAnalyser tailAnalyser;
+    
+    juce::Label cpuLabel;
+    juce::Label decayLabel;
+    
+    // Brings the dials and buttons up to date with their parameters once per display frame, so a
+    // burst of automation costs one repaint per control instead of one per change.
+    juce::VBlankAttachment parameterRefresh { this, [this] { refreshParameters(); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EditorContent)
 };
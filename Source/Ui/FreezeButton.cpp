@@ -11,9 +11,11 @@
 #include "FreezeButton.h"
 #include "UseColors.h"
 
-FreezeButton::FreezeButton (juce::RangedAudioParameter& param, juce::UndoManager* um)
+FreezeButton::FreezeButton (juce::RangedAudioParameter& param, juce::RangedAudioParameter& mode, juce::UndoManager* um)
 : audioParam(param)
 , paramAttachment (audioParam, [&] (float v) { updateState (static_cast<bool> (v)); }, um)
+, modeParam(mode)
+, modeAttachment (modeParam, nullptr, um)
 {
     setWantsKeyboardFocus (true);
     setRepaintsOnMouseActivity (true);
@@ -77,11 +79,14 @@ void FreezeButton::paint(juce::Graphics& g)
 
 void FreezeButton::mouseUp(const juce::MouseEvent& event)
 {
-    juce::ignoreUnused (event);
+    // Right-click picks how the freeze holds the tail.
+    if (event.mods.isPopupMenu())
+    {
+        showModeMenu();
+        return;
+    }
     
     paramAttachment.setValueAsCompleteGesture(! state);
-    
-    textBox.setText (audioParam.getCurrentValueAsText(), juce::NotificationType::dontSendNotification);
 }
 
 void FreezeButton::focusGained (FocusChangeType cause)
@@ -107,6 +112,11 @@ void FreezeButton::setLabelColor (juce::Colour newColor)
     label.setColour (juce::Label::textColourId, newColor);
 }
 
+void FreezeButton::refresh()
+{
+    paramAttachment.refresh();
+}
+
 bool FreezeButton::keyPressed(const juce::KeyPress& key)
 {
     if (key == juce::KeyPress::returnKey)
@@ -125,6 +135,24 @@ void FreezeButton::updateState(bool newState)
     repaint();
 }
 
+void FreezeButton::showModeMenu()
+{
+    const auto choices = modeParam.getAllValueStrings();
+    const auto current = static_cast<int> (modeParam.convertFrom0to1 (modeParam.getValue()));
+    
+    juce::PopupMenu menu;
+    
+    for (int i = 0; i < choices.size(); ++i)
+        menu.addItem (i + 1, choices[i], true, i == current);
+    
+    menu.showMenuAsync (juce::PopupMenu::Options().withTargetComponent (this),
+                        [safeThis = juce::Component::SafePointer<FreezeButton> (this)] (int result)
+                        {
+                            if (safeThis != nullptr && result > 0)
+                                safeThis->modeAttachment.setValueAsCompleteGesture (static_cast<float> (result - 1));
+                        });
+}
+
 void FreezeButton::drawRectangle(juce::Graphics &g)
 {
     auto fillColor = state ? findColour(onColorId) : findColour(offColorId);
@@ -13,6 +13,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "UseColors.h"
+#include "ParameterLink.h"
 
 class FreezeButton : public juce::Component
 {
@@ -25,7 +26,7 @@ public:
         focusColorId
     };
     
-    explicit FreezeButton(juce::RangedAudioParameter& param, juce::UndoManager* um = nullptr);
+    FreezeButton(juce::RangedAudioParameter& param, juce::RangedAudioParameter& modeParam, juce::UndoManager* um = nullptr);
     
     void paint (juce::Graphics& g) override;
     
@@ -42,8 +43,12 @@ public:
     void setLabelColor (juce::Colour newColor);
     void setLabelText (const juce::String& newLabelText);
     
+    // Catches up with the parameter, if it changed. The editor calls this once a frame.
+    void refresh();
+    
 private:
     void updateState (bool newState);
+    void showModeMenu();
     
     bool state { false };
     
@@ -51,7 +56,10 @@ private:
     void createBorder (const juce::Rectangle<float>& bounds);
     
     juce::RangedAudioParameter& audioParam;
-    juce::ParameterAttachment paramAttachment;
+    ParameterLink paramAttachment;
+    
+    juce::RangedAudioParameter& modeParam;
+    ParameterLink modeAttachment;
     
     juce::Rectangle<float> mainArea;
     juce::Path borderPath;
@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    Meter.cpp
+    Created: 19 Oct 2026 4:05:19pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "Meter.h"
+
+Meter::Meter (const juce::String& labelText)
+    : label (labelText)
+{
+    setOpaque (true);
+    setInterceptsMouseClicks (false, false);
+}
+
+void Meter::resized()
+{
+    renderBackground();
+}
+
+void Meter::paint (juce::Graphics& g)
+{
+    // The editor scales its content with a transform, which doesn't call resized() down here.
+    const auto scale = juce::Component::getApproximateScaleFactorForComponent (this);
+    
+    if (background.getWidth() != juce::roundToInt (static_cast<float> (getWidth()) * scale))
+        renderBackground();
+    
+    g.drawImage (background, getLocalBounds().toFloat());
+    
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const auto bar = getBarBounds (channel);
+        const auto& state = bars[channel];
+        const auto zeroDecibelX = gainToX (bar, 1.0f);
+        
+        // Everything left of the RMS edge is filled, the peak is a thin line that turns red on overs.
+        g.setColour (UseColors::green);
+        g.fillRect (bar.withRight (juce::jmin (state.rms, zeroDecibelX)));
+        
+        if (state.rms > zeroDecibelX)
+        {
+            g.setColour (UseColors::red);
+            g.fillRect (bar.withLeft (zeroDecibelX).withRight (state.rms));
+        }
+        
+        if (state.peak > bar.getX())
+        {
+            g.setColour (state.peak > zeroDecibelX ? UseColors::red : UseColors::yellow);
+            g.fillRect (bar.withLeft (state.peak - peakWidth).withWidth (peakWidth));
+        }
+    }
+}
+
+void Meter::setReading (const MeterReading& newReading)
+{
+    const auto newNumChannels = juce::jlimit (1, 2, newReading.numChannels);
+    
+    if (newNumChannels != numChannels)
+    {
+        numChannels = newNumChannels;
+        renderBackground();
+        repaint();
+    }
+    
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const auto bar = getBarBounds (channel);
+        const BarState next { gainToX (bar, newReading.rms[channel]), gainToX (bar, newReading.peak[channel]) };
+        auto& current = bars[channel];
+        
+        if (next.rms == current.rms && next.peak == current.peak)
+            continue;
+        
+        // Only the span between the old and new edges changes on screen.
+        const auto left = juce::jmin (current.rms, next.rms, current.peak - peakWidth, next.peak - peakWidth);
+        const auto right = juce::jmax (current.rms, next.rms, current.peak, next.peak);
+        
+        current = next;
+        repaint (bar.withLeft (juce::jmax (bar.getX(), left)).withRight (juce::jmin (bar.getRight(), right)));
+    }
+}
+
+juce::Rectangle<int> Meter::getBarBounds (int channel) const
+{
+    auto area = getLocalBounds().withTrimmedLeft (labelWidth).reduced (2);
+    const auto barHeight = numChannels > 1 ? (area.getHeight() - 2) / 2 : area.getHeight();
+    
+    return area.withHeight (barHeight).withY (area.getY() + channel * (barHeight + 2));
+}
+
+int Meter::gainToX (const juce::Rectangle<int>& bar, float gain) const
+{
+    const auto decibels = juce::Decibels::gainToDecibels (gain, minDecibels);
+    const auto proportion = juce::jmap (juce::jlimit (minDecibels, maxDecibels, decibels), minDecibels, maxDecibels, 0.0f, 1.0f);
+    
+    return bar.getX() + juce::roundToInt (proportion * static_cast<float> (bar.getWidth()));
+}
+
+void Meter::renderBackground()
+{
+    if (getWidth() <= 0 || getHeight() <= 0)
+        return;
+    
+    // Rendered at the size the editor is actually shown at, so scaling it up stays sharp.
+    const auto scale = juce::Component::getApproximateScaleFactorForComponent (this);
+    background = juce::Image (juce::Image::RGB,
+                              juce::roundToInt (static_cast<float> (getWidth()) * scale),
+                              juce::roundToInt (static_cast<float> (getHeight()) * scale),
+                              true);
+    
+    juce::Graphics g (background);
+    g.addTransform (juce::AffineTransform::scale (scale));
+    g.fillAll (UseColors::blue);
+    
+    g.setColour (UseColors::yellow);
+    g.setFont (juce::FontOptions { static_cast<float> (getHeight()) * 0.45f });
+    g.drawText (label, getLocalBounds().withWidth (labelWidth - 4), juce::Justification::centredRight);
+    
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const auto bar = getBarBounds (channel);
+        g.setColour (UseColors::blue.darker (0.6f));
+        g.fillRect (bar);
+        
+        g.setColour (UseColors::beige.withAlpha (0.35f));
+        
+        for (auto decibels : { -48.0f, -24.0f, -12.0f, -6.0f, 0.0f })
+            g.fillRect (bar.withX (gainToX (bar, juce::Decibels::decibelsToGain (decibels))).withWidth (1));
+    }
+}
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    Meter.h
+    Created: 19 Oct 2026 4:05:19pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "UseColors.h"
+#include "../Telemetry.h"
+#include <juce_gui_basics/juce_gui_basics.h>
+
+// Horizontal stereo peak/RMS meter. The label, tracks and scale are drawn once into a cached image,
+// and a new reading only repaints the stretch of each bar that actually moved.
+class Meter final : public juce::Component
+{
+    public:
+    explicit Meter (const juce::String& labelText);
+    
+    void paint (juce::Graphics& g) override;
+    void resized() override;
+    
+    void setReading (const MeterReading& newReading);
+    
+    private:
+    struct BarState
+    {
+        int rms { 0 };
+        int peak { 0 };
+    };
+    
+    juce::Rectangle<int> getBarBounds (int channel) const;
+    int gainToX (const juce::Rectangle<int>& bar, float gain) const;
+    void renderBackground();
+    
+    static constexpr auto minDecibels { -60.0f };
+    static constexpr auto maxDecibels { 6.0f };
+    static constexpr auto labelWidth { 40 };
+    static constexpr auto peakWidth { 2 };
+    
+    juce::String label;
+    juce::Image background;
+    BarState bars[2];
+    int numChannels { 2 };
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Meter)
+};
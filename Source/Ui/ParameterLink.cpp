@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    ParameterLink.cpp
+    Created: 19 Oct 2026 11:59:55pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "ParameterLink.h"
+
+ParameterLink::ParameterLink (juce::RangedAudioParameter& param, std::function<void (float)> onChange, juce::UndoManager* um)
+    : parameter (param)
+    , callback (std::move (onChange))
+    , undoManager (um)
+{
+    parameter.addListener (this);
+}
+
+ParameterLink::~ParameterLink()
+{
+    parameter.removeListener (this);
+}
+
+void ParameterLink::sendInitialUpdate()
+{
+    changed = true;
+    refresh();
+}
+
+void ParameterLink::refresh()
+{
+    if (! changed.exchange (false))
+        return;
+    
+    if (callback != nullptr)
+        callback (parameter.convertFrom0to1 (parameter.getValue()));
+}
+
+void ParameterLink::setValueAsCompleteGesture (float newDenormalisedValue)
+{
+    const auto newValue = parameter.convertTo0to1 (newDenormalisedValue);
+    
+    if (parameter.getValue() == newValue)
+        return;
+    
+    beginGesture();
+    parameter.setValueNotifyingHost (newValue);
+    endGesture();
+}
+
+void ParameterLink::beginGesture()
+{
+    if (undoManager != nullptr)
+        undoManager->beginNewTransaction();
+    
+    parameter.beginChangeGesture();
+}
+
+void ParameterLink::setValueAsPartOfGesture (float newDenormalisedValue)
+{
+    const auto newValue = parameter.convertTo0to1 (newDenormalisedValue);
+    
+    if (parameter.getValue() != newValue)
+        parameter.setValueNotifyingHost (newValue);
+}
+
+void ParameterLink::endGesture()
+{
+    parameter.endChangeGesture();
+}
@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    ParameterLink.h
+    Created: 19 Oct 2026 11:59:55pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+// Connects a control to a parameter like juce::ParameterAttachment, but without a message per
+// change. A change from any thread only raises a flag, and the control is told about it when the
+// editor calls refresh() on its next frame, however many changes came in since the last one.
+class ParameterLink final : private juce::AudioProcessorParameter::Listener
+{
+    public:
+    // `onChange` gets the new value, denormalised, on the message thread. It may be empty.
+    ParameterLink (juce::RangedAudioParameter& param, std::function<void (float)> onChange, juce::UndoManager* um = nullptr);
+    ~ParameterLink() override;
+    
+    // Hands over the current value straight away.
+    void sendInitialUpdate();
+    
+    // Hands over the current value if it has changed since the last time. Message thread.
+    void refresh();
+    
+    // As juce::ParameterAttachment: each call is a no-op if it wouldn't change the value.
+    void setValueAsCompleteGesture (float newDenormalisedValue);
+    void beginGesture();
+    void setValueAsPartOfGesture (float newDenormalisedValue);
+    void endGesture();
+    
+    private:
+    void parameterValueChanged (int, float) override { changed = true; }
+    void parameterGestureChanged (int, bool) override {}
+    
+    juce::RangedAudioParameter& parameter;
+    std::function<void (float)> callback;
+    juce::UndoManager* undoManager { nullptr };
+    
+    std::atomic<bool> changed { false };
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterLink)
+};
@@ -85,7 +85,6 @@ void Slider::mouseDrag (const juce::MouseEvent& e)
     value = juce::jlimit (0.0f, 1.0f, value + diffY);
     const auto newDenormValue = audioParam.convertFrom0to1 (value);
     paramAttachment.setValueAsPartOfGesture (newDenormValue);
-    textBox.setText (audioParam.getCurrentValueAsText(), juce::NotificationType::dontSendNotification);
 
     mousePosWhenLastDragged = e.position;
 }
@@ -108,8 +107,6 @@ void Slider::mouseDoubleClick (const juce::MouseEvent& e)
 
     const auto newDenormValue = audioParam.convertFrom0to1 (defaultValue);
     paramAttachment.setValueAsCompleteGesture (newDenormValue);
-
-    textBox.setText (audioParam.getCurrentValueAsText(), juce::NotificationType::dontSendNotification);
 }
 
 bool Slider::keyPressed (const juce::KeyPress& k)
@@ -155,6 +152,8 @@ void Slider::focusLost (FocusChangeType cause)
 
 float Slider::getValue() const { return audioParam.convertFrom0to1 (value); }
 
+void Slider::refresh() { paramAttachment.refresh(); }
+
 void Slider::setTextBoxColor (juce::Colour newColour)
 {
     textBox.setColour (juce::Label::textColourId, newColour);
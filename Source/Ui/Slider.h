@@ -11,6 +11,7 @@
 #pragma once
 
 #include "UseColors.h"
+#include "ParameterLink.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 
@@ -42,6 +43,9 @@ class Slider final : public juce::Component
     
     float getValue() const;
     
+    // Catches up with the parameter, if it changed. The editor calls this once a frame.
+    void refresh();
+    
     void setInterval (float newInterval);
     void setFineInterval (float newFineInterval);
     
@@ -56,7 +60,7 @@ class Slider final : public juce::Component
     void createBorder (const juce::Rectangle<float>& bounds);
     
     juce::RangedAudioParameter& audioParam;
-    juce::ParameterAttachment paramAttachment;
+    ParameterLink paramAttachment;
 
     float value {};
     
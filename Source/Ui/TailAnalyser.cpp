@@ -0,0 +1,211 @@
+/*
+  ==============================================================================
+
+    TailAnalyser.cpp
+    Created: 19 Oct 2026 5:21:36pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "TailAnalyser.h"
+
+TailAnalyser::TailAnalyser (SimpleRoomReverbAudioProcessor& p)
+    : processor (p),
+      fft (TableCache::get<juce::dsp::FFT> ("FFT " + juce::String (fftOrder), [] { return juce::dsp::FFT (fftOrder); })),
+      window (TableCache::get<juce::dsp::WindowingFunction<float>> ("Hann window " + juce::String (fftSize), []
+      {
+          return juce::dsp::WindowingFunction<float> (static_cast<size_t> (fftSize), juce::dsp::WindowingFunction<float>::hann, false);
+      }))
+{
+    setOpaque (true);
+    setInterceptsMouseClicks (false, false);
+    
+    std::fill (std::begin (analysed.spectrum), std::end (analysed.spectrum), minDecibels);
+    std::fill (std::begin (analysed.decay), std::end (analysed.decay), minDecibels);
+    shown = analysed;
+    
+    if (p.getSampleRate() > 0.0)
+        sampleRate = p.getSampleRate();
+    
+    // Nothing is reading the tap yet, so whatever is left in it from an earlier editor can be
+    // dropped from here before the analysis takes over as its reader. It runs ahead of other
+    // background work, since it is what the user is looking at.
+    processor.getWetTap().discardAll();
+    processor.setWetTapActive (true);
+    analysis.submit (WorkerPool::Priority::high, [this] { return analyse(); });
+}
+
+TailAnalyser::~TailAnalyser()
+{
+    processor.setWetTapActive (false);
+    
+    // Waits for an analysis that is already running to finish.
+    analysis.cancel();
+}
+
+void TailAnalyser::refresh()
+{
+    if (processor.getSampleRate() > 0.0)
+        sampleRate = processor.getSampleRate();
+    
+    Frame next;
+    
+    if (! frames.read (next))
+        return;
+    
+    const auto spectrumChanged = ! std::equal (std::begin (next.spectrum), std::end (next.spectrum), std::begin (shown.spectrum));
+    const auto decayChanged = ! std::equal (std::begin (next.decay), std::end (next.decay), std::begin (shown.decay));
+    
+    shown = next;
+    
+    if (spectrumChanged)
+        repaint (getSpectrumArea().toNearestInt());
+    
+    if (decayChanged)
+        repaint (getDecayArea().toNearestInt());
+}
+
+int TailAnalyser::analyse()
+{
+    auto& tap = processor.getWetTap();
+    float samples[512];
+    
+    // The tap is bounded, so this always catches up in a bounded amount of work.
+    for (auto numRead = tap.pop (samples, 512); numRead > 0; numRead = tap.pop (samples, 512))
+    {
+        for (int i = 0; i < numRead; ++i)
+        {
+            fifo[static_cast<size_t> (fifoFill++)] = samples[i];
+            
+            if (fifoFill == fftSize)
+            {
+                analyseFrame();
+                
+                std::copy (fifo.begin() + hopSize, fifo.end(), fifo.begin());
+                fifoFill = fftSize - hopSize;
+            }
+        }
+    }
+    
+    // About one editor frame, so new data is never waiting long.
+    return 15;
+}
+
+void TailAnalyser::analyseFrame()
+{
+    std::copy (fifo.begin(), fifo.end(), fftData.begin());
+    std::fill (fftData.begin() + fftSize, fftData.end(), 0.0f);
+    
+    // Overall level of this frame goes into the decay history before the window changes it.
+    const auto meanSquare = std::inner_product (fifo.begin(), fifo.end(), fifo.begin(), 0.0f) / static_cast<float> (fftSize);
+    std::copy (std::begin (analysed.decay) + 1, std::end (analysed.decay), std::begin (analysed.decay));
+    analysed.decay[decayLength - 1] = juce::Decibels::gainToDecibels (std::sqrt (meanSquare), minDecibels);
+    
+    window->multiplyWithWindowingTable (fftData.data(), static_cast<size_t> (fftSize));
+    fft->performFrequencyOnlyForwardTransform (fftData.data());
+    
+    // With a Hann window a full-scale sine peaks at fftSize / 4.
+    constexpr auto magnitudeScale = 4.0f / static_cast<float> (fftSize);
+    constexpr auto fallPerFrame = 3.0f;
+    
+    const auto binWidth = sampleRate.load() / fftSize;
+    const auto lastBin = fftSize / 2;
+    
+    for (int column = 0; column < numColumns; ++column)
+    {
+        const auto lowFreq = 20.0 * std::pow (1000.0, static_cast<double> (column) / numColumns);
+        const auto highFreq = 20.0 * std::pow (1000.0, static_cast<double> (column + 1) / numColumns);
+        const auto firstBin = juce::jlimit (1, lastBin, static_cast<int> (lowFreq / binWidth));
+        const auto endBin = juce::jlimit (firstBin + 1, lastBin + 1, static_cast<int> (highFreq / binWidth) + 1);
+        
+        const auto magnitude = *std::max_element (fftData.begin() + firstBin, fftData.begin() + endBin);
+        const auto decibels = juce::Decibels::gainToDecibels (magnitude * magnitudeScale, minDecibels);
+        
+        // Falling back gradually keeps the plot from flickering with every frame.
+        auto& shownDecibels = analysed.spectrum[column];
+        shownDecibels = juce::jmax (decibels, shownDecibels - fallPerFrame);
+    }
+    
+    frames.write (analysed);
+}
+
+//==============================================================================
+juce::Rectangle<float> TailAnalyser::getSpectrumArea() const
+{
+    auto bounds = getLocalBounds().toFloat();
+    return bounds.removeFromLeft (bounds.getWidth() * 0.68f).reduced (2.0f);
+}
+
+juce::Rectangle<float> TailAnalyser::getDecayArea() const
+{
+    auto bounds = getLocalBounds().toFloat();
+    bounds.removeFromLeft (bounds.getWidth() * 0.68f);
+    return bounds.withTrimmedLeft (8.0f).reduced (2.0f);
+}
+
+float TailAnalyser::decibelsToY (const juce::Rectangle<float>& area, float decibels)
+{
+    return juce::jmap (juce::jlimit (minDecibels, maxDecibels, decibels), minDecibels, maxDecibels, area.getBottom(), area.getY());
+}
+
+void TailAnalyser::paint (juce::Graphics& g)
+{
+    g.fillAll (UseColors::blue);
+    
+    const auto spectrumArea = getSpectrumArea();
+    const auto decayArea = getDecayArea();
+    
+    for (const auto& area : { spectrumArea, decayArea })
+    {
+        g.setColour (UseColors::blue.darker (0.6f));
+        g.fillRect (area);
+        
+        g.setColour (UseColors::beige.withAlpha (0.2f));
+        
+        for (auto decibels : { -72.0f, -48.0f, -24.0f })
+            g.drawHorizontalLine (juce::roundToInt (decibelsToY (area, decibels)), area.getX(), area.getRight());
+    }
+    
+    for (auto freq : { 100.0f, 1000.0f, 10000.0f })
+    {
+        const auto x = spectrumArea.getX() + spectrumArea.getWidth() * std::log (freq / 20.0f) / std::log (1000.0f);
+        g.drawVerticalLine (juce::roundToInt (x), spectrumArea.getY(), spectrumArea.getBottom());
+    }
+    
+    const auto columnWidth = spectrumArea.getWidth() / numColumns;
+    juce::Path spectrum;
+    spectrum.startNewSubPath (spectrumArea.getBottomLeft());
+    
+    for (int column = 0; column < numColumns; ++column)
+        spectrum.lineTo (spectrumArea.getX() + (static_cast<float> (column) + 0.5f) * columnWidth,
+                         decibelsToY (spectrumArea, shown.spectrum[column]));
+    
+    spectrum.lineTo (spectrumArea.getBottomRight());
+    spectrum.closeSubPath();
+    
+    g.setColour (UseColors::green.withAlpha (0.35f));
+    g.fillPath (spectrum);
+    g.setColour (UseColors::green);
+    g.strokePath (spectrum, juce::PathStrokeType { 1.5f });
+    
+    // The decay plot has a marker 60 dB under the loudest recent frame, so the time the trace takes
+    // to reach it reads as RT60.
+    const auto loudest = *std::max_element (std::begin (shown.decay), std::end (shown.decay));
+    
+    if (loudest - 60.0f > minDecibels)
+    {
+        g.setColour (UseColors::red.withAlpha (0.7f));
+        g.drawHorizontalLine (juce::roundToInt (decibelsToY (decayArea, loudest - 60.0f)), decayArea.getX(), decayArea.getRight());
+    }
+    
+    const auto stepWidth = decayArea.getWidth() / (decayLength - 1);
+    juce::Path decay;
+    decay.startNewSubPath (decayArea.getX(), decibelsToY (decayArea, shown.decay[0]));
+    
+    for (int i = 1; i < decayLength; ++i)
+        decay.lineTo (decayArea.getX() + static_cast<float> (i) * stepWidth, decibelsToY (decayArea, shown.decay[i]));
+    
+    g.setColour (UseColors::yellow);
+    g.strokePath (decay, juce::PathStrokeType { 1.5f });
+}
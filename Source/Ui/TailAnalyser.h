@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+
+    TailAnalyser.h
+    Created: 19 Oct 2026 5:21:36pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "UseColors.h"
+#include "../PluginProcessor.h"
+#include "../Concurrency/TripleBuffer.h"
+#include "../Concurrency/WorkerPool.h"
+#include "../Dsp/TableCache.h"
+#include <juce_dsp/juce_dsp.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+
+// Spectrum and decay envelope of the reverb's wet signal. The audio thread only copies samples into
+// the processor's wet tap while one of these exists. The FFTs run on the shared background
+// workers, and the message thread just draws the latest frame.
+class TailAnalyser final : public juce::Component
+{
+    public:
+    explicit TailAnalyser (SimpleRoomReverbAudioProcessor& p);
+    ~TailAnalyser() override;
+    
+    void paint (juce::Graphics& g) override;
+    
+    // Picks up the latest frame and repaints the plots that changed. The editor calls this at its
+    // frame rate, which also caps how often this repaints.
+    void refresh();
+    
+    private:
+    static constexpr int fftOrder { 11 };
+    static constexpr int fftSize { 1 << fftOrder };
+    static constexpr int hopSize { fftSize / 2 };
+    static constexpr int numColumns { 128 };
+    static constexpr int decayLength { 128 };
+    static constexpr float minDecibels { -96.0f };
+    static constexpr float maxDecibels { 0.0f };
+    
+    struct Frame
+    {
+        float spectrum[numColumns] {};      // dB per log-spaced column from 20 Hz to 20 kHz
+        float decay[decayLength] {};        // wet level of the most recent frames, oldest first
+    };
+    
+    // Background worker. Returns the time until it should look at the tap again.
+    int analyse();
+    void analyseFrame();
+    
+    juce::Rectangle<float> getSpectrumArea() const;
+    juce::Rectangle<float> getDecayArea() const;
+    static float decibelsToY (const juce::Rectangle<float>& area, float decibels);
+    
+    SimpleRoomReverbAudioProcessor& processor;
+    std::atomic<double> sampleRate { 44100.0 };
+    
+    // Shared with every other analyser, and only ever read.
+    TableCache::Pointer<juce::dsp::FFT> fft;
+    TableCache::Pointer<juce::dsp::WindowingFunction<float>> window;
+    
+    // Analysis thread only.
+    std::array<float, fftSize> fifo {};
+    std::array<float, 2 * fftSize> fftData {};
+    int fifoFill { 0 };
+    Frame analysed;
+    
+    TripleBuffer<Frame> frames;
+    
+    // Message thread only.
+    Frame shown;
+    
+    juce::SharedResourcePointer<WorkerPool> workers;
+    WorkerPool::Token analysis { *workers };
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TailAnalyser)
+};
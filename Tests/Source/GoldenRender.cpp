@@ -0,0 +1,320 @@
+/*
+  ==============================================================================
+
+    GoldenRender.cpp
+    Created: 19 Oct 2026 11:59:58pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "GoldenRender.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Golden
+{
+namespace
+{
+    // What createParameterLayout() gives a new instance.
+    const Value defaults[] {
+        { Parameters::size, 50.0f },
+        { Parameters::damp, 50.0f },
+        { Parameters::width, 50.0f },
+        { Parameters::mix, 50.0f },
+        { Parameters::freeze, 0.0f },
+        { Parameters::freezeMode, 0.0f },
+        { Parameters::decayMode, 0.0f },
+        { Parameters::decayTime, 2.0f },
+        { Parameters::dampFreq, 5000.0f },
+        { Parameters::lowDecay, 1.0f },
+        { Parameters::midDecay, 1.0f },
+        { Parameters::highDecay, 1.0f },
+        { Parameters::lowCrossover, 250.0f },
+        { Parameters::highCrossover, 4000.0f },
+        { Parameters::early, 0.0f },
+        { Parameters::duckThreshold, -24.0f },
+        { Parameters::duckDepth, 0.0f },
+        { Parameters::duckAttack, 5.0f },
+        { Parameters::duckRelease, 250.0f },
+        { Parameters::duckKey, 0.0f },
+        { Parameters::gate, 0.0f },
+        { Parameters::gateThreshold, -30.0f },
+        { Parameters::gateHold, 250.0f },
+        { Parameters::gateRelease, 80.0f },
+        { Parameters::gateSync, 0.0f },
+        { Parameters::gateDivision, 3.0f },
+        { Parameters::lowPass, 20000.0f },
+        { Parameters::highPass, 20.0f },
+        { Parameters::bypass, 0.0f },
+    };
+
+    RoomGeometry makeSmallRoom()
+    {
+        RoomGeometry room;
+        room.width = 4.5f;
+        room.depth = 6.0f;
+        room.height = 2.8f;
+        room.sourceX = 0.2f;
+        room.listenerX = 0.7f;
+        room.absorption = 0.15f;
+        return room;
+    }
+
+    std::vector<Preset> makePresets()
+    {
+        std::vector<Preset> presets;
+
+        presets.push_back ({ "Default", {}, CoreMode::classic, {}, {} });
+
+        presets.push_back ({ "DarkHall",
+                             { { Parameters::size, 92.0f }, { Parameters::damp, 80.0f }, { Parameters::width, 100.0f },
+                               { Parameters::mix, 60.0f }, { Parameters::lowPass, 6000.0f }, { Parameters::highPass, 80.0f } },
+                             CoreMode::fractional, {}, {} });
+
+        presets.push_back ({ "TunedRoom",
+                             { { Parameters::decayMode, 1.0f }, { Parameters::decayTime, 1.2f }, { Parameters::dampFreq, 3000.0f },
+                               { Parameters::lowDecay, 1.5f }, { Parameters::highDecay, 0.6f }, { Parameters::early, 70.0f },
+                               { Parameters::mix, 40.0f } },
+                             CoreMode::reducedRate, makeSmallRoom(), {} });
+
+        // Events deliberately fall off the micro-block grid.
+        presets.push_back ({ "Automated",
+                             { { Parameters::duckDepth, 12.0f }, { Parameters::duckThreshold, -30.0f } },
+                             CoreMode::classic, {},
+                             { { 1000, { { Parameters::size, 85.0f }, { Parameters::damp, 20.0f } } },
+                               { 2100, { { Parameters::lowPass, 4000.0f }, { Parameters::highPass, 200.0f }, { Parameters::width, 20.0f } } },
+                               { 3001, { { Parameters::freeze, 1.0f } } },
+                               { 4200, { { Parameters::freeze, 0.0f }, { Parameters::mix, 80.0f }, { Parameters::gate, 1.0f } } } } });
+
+        return presets;
+    }
+
+    void set (std::vector<Value>& values, const Value& value)
+    {
+        for (auto& v : values)
+        {
+            if (std::strcmp (v.id, value.id) == 0)
+            {
+                v.value = value.value;
+                return;
+            }
+        }
+
+        jassertfalse;   // not a parameter makeSettings() reads
+    }
+
+    // xorshift32, so the noise is the same everywhere.
+    uint32_t nextRandom (uint32_t& state) noexcept
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+}
+
+// Written as float first, so both precisions get exactly the same input.
+template <typename SampleType>
+void fillInput (juce::AudioBuffer<SampleType>& buffer, Input input, double sampleRate)
+{
+    buffer.clear();
+    const auto numSamples = buffer.getNumSamples();
+
+    // Most of the render is left for the tail.
+    const auto signalLength = numSamples * 3 / 5;
+
+    switch (input)
+    {
+        case Input::impulse:
+            buffer.setSample (0, 0, static_cast<SampleType> (1));
+            break;
+
+        case Input::sweep:
+        {
+            const auto startFreq = 20.0, endFreq = 20000.0;
+            const auto duration = signalLength / sampleRate;
+            const auto rate = std::log (endFreq / startFreq);
+
+            for (int i = 0; i < signalLength; ++i)
+            {
+                const auto t = i / sampleRate;
+                const auto phase = juce::MathConstants<double>::twoPi * startFreq * duration / rate
+                                 * (std::exp (t * rate / duration) - 1.0);
+                const auto sample = static_cast<float> (0.5 * std::sin (phase));
+
+                for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+                    buffer.setSample (channel, i, static_cast<SampleType> (sample));
+            }
+            break;
+        }
+
+        case Input::pinkNoise:
+        {
+            for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            {
+                uint32_t state = 0x9e3779b9u + static_cast<uint32_t> (channel) * 0x85ebca6bu;
+                double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+
+                for (int i = 0; i < signalLength; ++i)
+                {
+                    // Paul Kellet's economy filter, about -3 dB per octave.
+                    const auto white = nextRandom (state) / 2147483648.0 - 1.0;
+                    b0 = 0.99765 * b0 + white * 0.0990460;
+                    b1 = 0.96300 * b1 + white * 0.2965164;
+                    b2 = 0.57000 * b2 + white * 1.0526913;
+                    const auto sample = static_cast<float> (0.1 * (b0 + b1 + b2 + white * 0.1848));
+
+                    buffer.setSample (channel, i, static_cast<SampleType> (sample));
+                }
+            }
+            break;
+        }
+    }
+}
+
+template void fillInput (juce::AudioBuffer<float>&, Input, double);
+template void fillInput (juce::AudioBuffer<double>&, Input, double);
+
+const std::vector<Preset>& getPresets()
+{
+    static const auto presets = makePresets();
+    return presets;
+}
+
+const char* getName (Input input)
+{
+    switch (input)
+    {
+        case Input::impulse:    return "Impulse";
+        case Input::sweep:      return "Sweep";
+        case Input::pinkNoise:  return "PinkNoise";
+    }
+
+    return "";
+}
+
+std::vector<Case> getReferenceCases()
+{
+    const Input inputs[] { Input::impulse, Input::sweep, Input::pinkNoise };
+    std::vector<Case> cases;
+
+    for (const auto& preset : getPresets())
+        for (auto input : inputs)
+            cases.push_back ({ &preset, input, 44100.0 });
+
+    for (const auto& preset : getPresets())
+        if (preset.coreMode == CoreMode::reducedRate)
+            for (auto input : inputs)
+                cases.push_back ({ &preset, input, 96000.0 });
+
+    return cases;
+}
+
+int getNumSamples (double sampleRate)
+{
+    return juce::roundToInt (sampleRate * 0.125);
+}
+
+juce::String getReferenceName (const Case& c)
+{
+    return juce::String (c.preset->name) + "_" + getName (c.input) + "_" + juce::String (juce::roundToInt (c.sampleRate));
+}
+
+Settings getSettings (const Preset& preset, int sample)
+{
+    std::vector<Value> values (std::begin (defaults), std::end (defaults));
+
+    for (const auto& value : preset.values)
+        set (values, value);
+
+    for (const auto& event : preset.automation)
+        if (event.sample <= sample)
+            for (const auto& value : event.values)
+                set (values, value);
+
+    return makeSettings ([&values] (const char* id)
+    {
+        for (const auto& v : values)
+            if (std::strcmp (v.id, id) == 0)
+                return v.value;
+
+        jassertfalse;
+        return 0.0f;
+    });
+}
+
+//==============================================================================
+template <typename SampleType>
+Renderer<SampleType>::Renderer (const Case& c)
+    : renderCase (c),
+      numSamples (getNumSamples (c.sampleRate)),
+      input (2, numSamples)
+{
+    fillInput (input, c.input, c.sampleRate);
+}
+
+template <typename SampleType>
+juce::AudioBuffer<float> Renderer<SampleType>::render (int blockSize, ForkJoinPool* pool)
+{
+    const auto& preset = *renderCase.preset;
+    const auto initial = getSettings (preset, 0);
+
+    // The same order as prepareToPlay(): settings, core and room first, then prepare and reset.
+    engine.setSettings (initial, true);
+    engine.setCoreMode (preset.coreMode);
+    engine.setReflectionTaps (computeImageSources (preset.room));
+    engine.prepare ({ renderCase.sampleRate, static_cast<juce::uint32> (blockSize), 2 });
+    engine.reset();
+    ramp.reset (initial);
+
+    juce::AudioBuffer<SampleType> buffer (input);
+    const auto settingsAt = [this] (int) { return ramp.next(); };
+
+    for (int blockStart = 0; blockStart < numSamples;)
+    {
+        auto blockEnd = juce::jmin (blockStart + blockSize, numSamples);
+
+        for (const auto& event : preset.automation)
+            if (event.sample > blockStart && event.sample < blockEnd)
+                blockEnd = event.sample;
+
+        ramp.setTarget (getSettings (preset, blockStart));
+
+        auto block = juce::dsp::AudioBlock<SampleType> (buffer).getSubBlock (static_cast<size_t> (blockStart),
+                                                                           static_cast<size_t> (blockEnd - blockStart));
+        const juce::dsp::AudioBlock<const SampleType> key (block);
+
+        engine.process (block, key, settingsAt, pool, nullptr);
+        blockStart = blockEnd;
+    }
+
+    juce::AudioBuffer<float> output (buffer.getNumChannels(), numSamples);
+
+    for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        for (int i = 0; i < numSamples; ++i)
+            output.setSample (channel, i, static_cast<float> (buffer.getSample (channel, i)));
+
+    return output;
+}
+
+template class Renderer<float>;
+template class Renderer<double>;
+
+//==============================================================================
+double getMaxDifferenceDecibels (const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b)
+{
+    jassert (a.getNumChannels() == b.getNumChannels() && a.getNumSamples() == b.getNumSamples());
+
+    double maxDifference = 0.0;
+
+    for (int channel = 0; channel < a.getNumChannels(); ++channel)
+        for (int i = 0; i < a.getNumSamples(); ++i)
+            maxDifference = juce::jmax (maxDifference, std::abs (static_cast<double> (a.getSample (channel, i))
+                                                                 - static_cast<double> (b.getSample (channel, i))));
+
+    return maxDifference > 0.0 ? 20.0 * std::log10 (maxDifference)
+                               : -std::numeric_limits<double>::infinity();
+}
+}
@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+
+    GoldenRender.h
+    Created: 19 Oct 2026 11:59:58pm
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "../../Source/Dsp/Engine.h"
+#include "../../Source/Dsp/ImageSource.h"
+#include <vector>
+
+// The canonical renders the regression tests compare against their references: a few parameter
+// presets, one of them automated, fed an impulse, a sine sweep and pink noise. Everything here is
+// generated from fixed seeds and formulas, so a render only changes when the DSP does.
+namespace Golden
+{
+    enum class Input
+    {
+        impulse,        // a unit impulse on the left channel only
+        sweep,          // an exponential sine sweep from 20 Hz to 20 kHz, the same on both channels
+        pinkNoise       // a different stretch of pink noise on each channel
+    };
+
+    // A plain parameter value, as the host would set it.
+    struct Value
+    {
+        const char* id;
+        float value;
+    };
+
+    // Values set from `sample` on.
+    struct Event
+    {
+        int sample;
+        std::vector<Value> values;
+    };
+
+    struct Preset
+    {
+        const char* name;
+        std::vector<Value> values;          // on top of the parameter defaults
+        CoreMode coreMode { CoreMode::classic };
+        RoomGeometry room;
+        std::vector<Event> automation;
+    };
+
+    struct Case
+    {
+        const Preset* preset;
+        Input input;
+        double sampleRate;
+    };
+
+    const std::vector<Preset>& getPresets();
+    const char* getName (Input input);
+
+    // Every preset with every input at 44.1 kHz, and every input once more through the tuned room at
+    // 96 kHz, where the reduced-rate core resamples.
+    std::vector<Case> getReferenceCases();
+
+    // Length of every render. Long enough for the tank to go round a few times.
+    int getNumSamples (double sampleRate);
+
+    // What the reference file for a case is called, without the extension.
+    juce::String getReferenceName (const Case& c);
+
+    // The snapshot a preset has at `sample`, with every event up to and including that sample applied.
+    Settings getSettings (const Preset& preset, int sample = 0);
+
+    // Writes an input over the whole buffer, the same in either precision.
+    template <typename SampleType>
+    void fillInput (juce::AudioBuffer<SampleType>& buffer, Input input, double sampleRate);
+
+    // Drives one engine the way the processor does: a snapshot ramp stepped per micro-block and
+    // host blocks of a given size, split wherever an automation event falls inside one, like a
+    // host with sample-accurate automation would.
+    template <typename SampleType>
+    class Renderer
+    {
+    public:
+        explicit Renderer (const Case& c);
+
+        // Prepares the engine afresh every time, as the processor does in prepareToPlay(). With a
+        // pool the tanks run on it as in an offline render.
+        juce::AudioBuffer<float> render (int blockSize, ForkJoinPool* pool = nullptr);
+
+    private:
+        Case renderCase;
+        int numSamples;
+        juce::AudioBuffer<SampleType> input;
+
+        Engine<SampleType> engine;
+        SettingsRamp ramp;
+    };
+
+    // Largest difference between two renders of the same length, in dB relative to full scale.
+    // Identical renders give -infinity.
+    double getMaxDifferenceDecibels (const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b);
+}
@@ -0,0 +1,67 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+    Created: 20 Oct 2026 12:41:06am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "RegressionTests.h"
+
+namespace
+{
+    // The references sit next to the .jucer, a few folders up from wherever the exporter puts
+    // the executable.
+    juce::File findReferences()
+    {
+        auto directory = juce::File::getSpecialLocation (juce::File::currentExecutableFile).getParentDirectory();
+
+        for (; directory != directory.getParentDirectory(); directory = directory.getParentDirectory())
+            if (directory.getChildFile ("References").isDirectory())
+                return directory.getChildFile ("References");
+
+        return {};
+    }
+}
+
+// RegressionTests [--references=<folder>] [--exact] [--record]
+//
+// Runs the regression tests against the references, or with --record replaces the references with
+// what the engine and the processor render now. Only record after checking by ear that a change in
+// the output is intended.
+int main (int argc, char* argv[])
+{
+    const juce::ArgumentList args (argc, argv);
+
+    // The processor needs a message manager, even without an editor. Nothing here runs its loop.
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    RegressionTests::Options options;
+    options.exact = args.containsOption ("--exact");
+    options.references = args.containsOption ("--references")
+                       ? juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--references"))
+                       : findReferences();
+
+    if (options.references == juce::File())
+    {
+        std::cout << "Couldn't find the References folder, pass it with --references=<folder>" << std::endl;
+        return 1;
+    }
+
+    if (args.containsOption ("--record"))
+        return RegressionTests::record (options.references) ? 0 : 1;
+
+    RegressionTests::setOptions (options);
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure (false);
+    runner.runTestsInCategory ("Regression");
+
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        if (runner.getResult (i)->failures > 0)
+            return 1;
+
+    return 0;
+}
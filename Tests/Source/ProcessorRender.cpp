@@ -0,0 +1,210 @@
+/*
+  ==============================================================================
+
+    ProcessorRender.cpp
+    Created: 20 Oct 2026 4:12:37am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "ProcessorRender.h"
+
+namespace Golden
+{
+namespace
+{
+    std::vector<Session> makeSessions()
+    {
+        std::vector<Session> sessions;
+
+        // Keyed by the sidechain, then by the main input, morphing from A to B with a switch to a
+        // program on the way, and bypassed for a while towards the end. The program brings its
+        // own decay mode and ducking in, the morph keeps the continuous parameters. Events
+        // deliberately fall off the micro-block grid.
+        sessions.push_back ({ "Session",
+                              { { Parameters::duckKey, 1.0f }, { Parameters::duckDepth, 18.0f }, { Parameters::duckThreshold, -36.0f } },
+                              { { Parameters::size, 40.0f }, { Parameters::damp, 60.0f }, { Parameters::width, 60.0f }, { Parameters::mix, 40.0f } },
+                              { { Parameters::size, 90.0f }, { Parameters::damp, 15.0f }, { Parameters::width, 100.0f }, { Parameters::mix, 70.0f },
+                                { Parameters::lowPass, 9000.0f } },
+                              true,
+                              { { 700, { { Parameters::morph, 40.0f } } },
+                                { 1500, { { Parameters::duckKey, 0.0f } } },
+                                { 2100, {}, "Hall 3.5 s" },
+                                { 3001, { { Parameters::morph, 100.0f } } },
+                                { 4200, { { Parameters::bypass, 1.0f } } },
+                                { 4700, { { Parameters::bypass, 0.0f } } } } });
+
+        return sessions;
+    }
+
+    // 10 ms of a 1 kHz tone every 30 ms, the same on both channels.
+    template <typename SampleType>
+    void fillBursts (juce::AudioBuffer<SampleType>& buffer, int firstChannel, double sampleRate)
+    {
+        const auto burstLength = juce::roundToInt (sampleRate * 0.01);
+        const auto period = juce::roundToInt (sampleRate * 0.03);
+
+        for (int i = 0; i < buffer.getNumSamples(); ++i)
+        {
+            const auto sample = i % period < burstLength
+                              ? static_cast<float> (0.5 * std::sin (juce::MathConstants<double>::twoPi * 1000.0 * i / sampleRate))
+                              : 0.0f;
+
+            for (int channel = firstChannel; channel < buffer.getNumChannels(); ++channel)
+                buffer.setSample (channel, i, static_cast<SampleType> (sample));
+        }
+    }
+
+    void set (juce::AudioProcessorValueTreeState& apvts, const std::vector<Value>& values)
+    {
+        for (const auto& v : values)
+        {
+            auto* parameter = apvts.getParameter (v.id);
+            jassert (parameter != nullptr);
+            parameter->setValueNotifyingHost (parameter->convertTo0to1 (v.value));
+        }
+    }
+
+    void switchToProgram (juce::AudioProcessor& processor, const juce::String& name)
+    {
+        for (int i = 0; i < processor.getNumPrograms(); ++i)
+        {
+            if (processor.getProgramName (i) == name)
+            {
+                processor.setCurrentProgram (i);
+                return;
+            }
+        }
+
+        jassertfalse;   // not a factory program
+    }
+}
+
+const std::vector<Session>& getSessions()
+{
+    static const auto sessions = makeSessions();
+    return sessions;
+}
+
+juce::String getReferenceName (const Session& session)
+{
+    return juce::String (session.name) + "_" + juce::String (juce::roundToInt (session.sampleRate));
+}
+
+bool canRenderThroughProcessor (const Case& c)
+{
+    if (getSettings (*c.preset).earlyLevel > 0.0f)
+        return false;
+
+    for (const auto& event : c.preset->automation)
+        if (getSettings (*c.preset, event.sample).earlyLevel > 0.0f)
+            return false;
+
+    return true;
+}
+
+//==============================================================================
+template <typename SampleType>
+ProcessorRenderer<SampleType>::ProcessorRenderer (const Session& s)
+    : session (s),
+      numSamples (getNumSamples (s.sampleRate)),
+      input (s.sidechain ? 4 : 2, numSamples)
+{
+    juce::AudioBuffer<SampleType> main (2, numSamples);
+    fillInput (main, Input::pinkNoise, s.sampleRate);
+
+    for (int channel = 0; channel < 2; ++channel)
+        input.copyFrom (channel, 0, main, channel, 0, numSamples);
+
+    if (s.sidechain)
+        fillBursts (input, 2, s.sampleRate);
+}
+
+template <typename SampleType>
+ProcessorRenderer<SampleType>::ProcessorRenderer (const Case& c)
+    : session { c.preset->name, c.preset->values, {}, {}, false, {}, c.sampleRate },
+      numSamples (getNumSamples (c.sampleRate)),
+      input (2, numSamples)
+{
+    jassert (canRenderThroughProcessor (c));
+
+    session.values.push_back ({ Parameters::coreMode, static_cast<float> (c.preset->coreMode) });
+
+    for (const auto& event : c.preset->automation)
+        session.automation.push_back ({ event.sample, event.values });
+
+    fillInput (input, c.input, c.sampleRate);
+}
+
+template <typename SampleType>
+juce::AudioBuffer<float> ProcessorRenderer<SampleType>::render (int blockSize, bool isNonRealtime)
+{
+    SimpleRoomReverbAudioProcessor processor;
+    auto& apvts = processor.getPluginState();
+
+    set (apvts, session.values);
+
+    if (! session.snapshotA.empty())
+    {
+        set (apvts, session.snapshotA);
+        processor.captureSnapshot (SnapshotMorph::Slot::a);
+        set (apvts, session.snapshotB);
+        processor.captureSnapshot (SnapshotMorph::Slot::b);
+    }
+
+    // The sidechain stays off until the host connects it.
+    if (session.sidechain)
+        processor.getBus (true, 1)->enable();
+
+    processor.setProcessingPrecision (std::is_same_v<SampleType, double> ? juce::AudioProcessor::doublePrecision
+                                                                         : juce::AudioProcessor::singlePrecision);
+    processor.setNonRealtime (isNonRealtime);
+    processor.setRateAndBufferSizeDetails (session.sampleRate, blockSize);
+    processor.prepareToPlay (session.sampleRate, blockSize);
+
+    // One channel per input and output, the main input first and the output written over it.
+    const auto numChannels = juce::jmax (processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+    jassert (numChannels == input.getNumChannels());
+
+    juce::AudioBuffer<SampleType> buffer (input);
+    juce::MidiBuffer midi;
+
+    for (int blockStart = 0; blockStart < numSamples;)
+    {
+        auto blockEnd = juce::jmin (blockStart + blockSize, numSamples);
+
+        for (const auto& event : session.automation)
+        {
+            if (event.sample == blockStart)
+            {
+                set (apvts, event.values);
+
+                if (event.program != nullptr)
+                    switchToProgram (processor, event.program);
+            }
+            else if (event.sample > blockStart && event.sample < blockEnd)
+            {
+                blockEnd = event.sample;
+            }
+        }
+
+        juce::AudioBuffer<SampleType> block (buffer.getArrayOfWritePointers(), numChannels, blockStart, blockEnd - blockStart);
+        processor.processBlock (block, midi);
+        blockStart = blockEnd;
+    }
+
+    processor.releaseResources();
+
+    juce::AudioBuffer<float> output (2, numSamples);
+
+    for (int channel = 0; channel < 2; ++channel)
+        for (int i = 0; i < numSamples; ++i)
+            output.setSample (channel, i, static_cast<float> (buffer.getSample (channel, i)));
+
+    return output;
+}
+
+template class ProcessorRenderer<float>;
+template class ProcessorRenderer<double>;
+}
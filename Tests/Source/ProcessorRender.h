@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    ProcessorRender.h
+    Created: 20 Oct 2026 4:12:37am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "GoldenRender.h"
+#include "../../Source/PluginProcessor.h"
+
+// Renders through the whole plugin rather than the engine alone, so whatever the processor does
+// around the engine is held to a reference as well: the buses, the snapshot ramp and the morph
+// it reads at every micro-block, program changes and the bypass.
+namespace Golden
+{
+    // What the host does to the plugin at `sample`, between two blocks.
+    struct HostEvent
+    {
+        int sample;
+        std::vector<Value> values;          // plain parameter values
+        const char* program { nullptr };    // a factory program to switch to
+    };
+
+    // The main input is pink noise. The sidechain, when connected, carries tone bursts, so the
+    // ducking it keys comes and goes.
+    //
+    // Nothing here runs the message loop, so a program change stays pending for the rest of the
+    // render and the processor's own stand-in for its parameters is what gets heard. The early
+    // reflections stay off, since their taps are worked out in the background.
+    struct Session
+    {
+        const char* name;
+        std::vector<Value> values;          // on top of the parameter defaults
+        std::vector<Value> snapshotA;       // set on top of those and captured as A, both empty for no morph
+        std::vector<Value> snapshotB;       // then these, captured as B
+        bool sidechain { false };
+        std::vector<HostEvent> automation;
+        double sampleRate { 44100.0 };
+    };
+
+    const std::vector<Session>& getSessions();
+
+    // What the reference file for a session is called, without the extension.
+    juce::String getReferenceName (const Session& session);
+
+    // Whether an engine case can go through the processor as well. The early reflections have to
+    // stay off, see Session.
+    bool canRenderThroughProcessor (const Case& c);
+
+    // Drives a fresh SimpleRoomReverbAudioProcessor the way a host does: the parameters set through
+    // the host interface, the buses laid out, prepareToPlay() and then processBlock() with blocks of
+    // a given size, split wherever an event falls inside one.
+    template <typename SampleType>
+    class ProcessorRenderer
+    {
+    public:
+        explicit ProcessorRenderer (const Session& session);
+
+        // The same render as Renderer gives for the case, parameters permitting.
+        explicit ProcessorRenderer (const Case& c);
+
+        // Offline renders split the tanks across the shared fork-join helpers once a block is large
+        // enough.
+        juce::AudioBuffer<float> render (int blockSize, bool isNonRealtime = false);
+
+    private:
+        Session session;
+        int numSamples;
+        juce::AudioBuffer<SampleType> input;    // the main channels, then the sidechain's
+    };
+}
@@ -0,0 +1,331 @@
+/*
+  ==============================================================================
+
+    RegressionTests.cpp
+    Created: 20 Oct 2026 12:41:06am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#include "RegressionTests.h"
+#include "GoldenRender.h"
+#include "ProcessorRender.h"
+
+namespace RegressionTests
+{
+namespace
+{
+    // Largest difference allowed from a reference when the match doesn't have to be exact. Far
+    // below anything audible, far above what rounding differences between builds come to.
+    constexpr double floatTolerance { -100.0 };
+
+    // The double engine is held against the same float references. In practice the two
+    // precisions are 110 dB or more apart on every case.
+    constexpr double doubleTolerance { -96.0 };
+
+    // Host buffer sizes every render has to come out the same at: single samples, sizes that
+    // don't divide a micro-block, exactly one, sizes that don't line up with it, and one larger
+    // than a whole batch. 64 is what the others are compared against.
+    constexpr int referenceBlockSize { 64 };
+    const int blockSizes[] { 1, 7, 32, 100, 480, 10000 };
+
+    Options options;
+
+    juce::File getReferenceFile (const juce::File& directory, const Golden::Case& c)
+    {
+        return directory.getChildFile (Golden::getReferenceName (c) + ".wav");
+    }
+
+    juce::File getReferenceFile (const juce::File& directory, const Golden::Session& session)
+    {
+        return directory.getChildFile (Golden::getReferenceName (session) + ".wav");
+    }
+
+    juce::AudioBuffer<float> readReference (const juce::File& file)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader (juce::WavAudioFormat().createReaderFor (file.createInputStream().release(), true));
+
+        if (reader == nullptr)
+            return {};
+
+        juce::AudioBuffer<float> buffer (static_cast<int> (reader->numChannels), static_cast<int> (reader->lengthInSamples));
+        reader->read (&buffer, 0, buffer.getNumSamples(), 0, true, true);
+        return buffer;
+    }
+
+    bool writeReference (const juce::File& file, const juce::AudioBuffer<float>& buffer, double sampleRate)
+    {
+        file.deleteFile();
+        std::unique_ptr<juce::OutputStream> stream (file.createOutputStream());
+
+        if (stream == nullptr)
+            return false;
+
+        // 32-bit float, so a reference reads back exactly as it was rendered.
+        std::unique_ptr<juce::AudioFormatWriter> writer (juce::WavAudioFormat().createWriterFor (stream.get(), sampleRate, 2, 32, {}, 0));
+
+        if (writer == nullptr)
+            return false;
+
+        // The writer owns the stream from here on.
+        stream.release();
+
+        return writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+    }
+
+    bool isIdentical (const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b)
+    {
+        if (a.getNumChannels() != b.getNumChannels() || a.getNumSamples() != b.getNumSamples())
+            return false;
+
+        for (int channel = 0; channel < a.getNumChannels(); ++channel)
+            if (std::memcmp (a.getReadPointer (channel), b.getReadPointer (channel), sizeof (float) * static_cast<size_t> (a.getNumSamples())) != 0)
+                return false;
+
+        return true;
+    }
+}
+
+void setOptions (const Options& newOptions)
+{
+    options = newOptions;
+}
+
+bool record (const juce::File& directory)
+{
+    if (! directory.createDirectory())
+        return false;
+
+    auto succeeded = true;
+
+    const auto write = [&succeeded] (const juce::File& file, const juce::AudioBuffer<float>& render, double sampleRate)
+    {
+        if (writeReference (file, render, sampleRate))
+        {
+            std::cout << "Recorded " << file.getFullPathName() << std::endl;
+        }
+        else
+        {
+            std::cout << "Couldn't write " << file.getFullPathName() << std::endl;
+            succeeded = false;
+        }
+    };
+
+    for (const auto& c : Golden::getReferenceCases())
+    {
+        Golden::Renderer<float> renderer (c);
+        write (getReferenceFile (directory, c), renderer.render (referenceBlockSize), c.sampleRate);
+    }
+
+    for (const auto& session : Golden::getSessions())
+    {
+        Golden::ProcessorRenderer<float> renderer (session);
+        write (getReferenceFile (directory, session), renderer.render (referenceBlockSize), session.sampleRate);
+    }
+
+    return succeeded;
+}
+
+//==============================================================================
+class EngineRegressionTest : public juce::UnitTest
+{
+public:
+    EngineRegressionTest() : juce::UnitTest ("Engine regression", "Regression") {}
+
+    void runTest() override
+    {
+        const auto cases = Golden::getReferenceCases();
+
+        beginTest ("Output is the same at every host buffer size");
+        {
+            for (const auto& c : cases)
+            {
+                expectBlockSizeIndependent<float> (c);
+                expectBlockSizeIndependent<double> (c);
+            }
+        }
+
+        beginTest ("A reset engine renders the same again");
+        {
+            for (const auto& c : cases)
+            {
+                Golden::Renderer<float> renderer (c);
+                const auto first = renderer.render (referenceBlockSize);
+                expect (isIdentical (first, renderer.render (referenceBlockSize)), Golden::getReferenceName (c));
+            }
+        }
+
+        beginTest ("Splitting the tanks across the fork-join pool changes nothing");
+        {
+            ForkJoinPool pool;
+            pool.start();
+
+            for (const auto& c : cases)
+            {
+                Golden::Renderer<float> floatRenderer (c);
+                expect (isIdentical (floatRenderer.render (512), floatRenderer.render (512, &pool)), Golden::getReferenceName (c));
+
+                Golden::Renderer<double> doubleRenderer (c);
+                expect (isIdentical (doubleRenderer.render (512), doubleRenderer.render (512, &pool)), Golden::getReferenceName (c));
+            }
+        }
+
+        beginTest ("Float renders match the references");
+        {
+            for (const auto& c : cases)
+            {
+                const auto file = getReferenceFile (options.references, c);
+                const auto reference = readReference (file);
+                const auto isComplete = reference.getNumSamples() == Golden::getNumSamples (c.sampleRate);
+
+                expect (isComplete, "Missing or truncated reference " + file.getFullPathName());
+
+                if (! isComplete)
+                    continue;
+
+                Golden::Renderer<float> renderer (c);
+                const auto render = renderer.render (referenceBlockSize);
+
+                if (options.exact)
+                    expect (isIdentical (render, reference), Golden::getReferenceName (c) + " differs by "
+                                                             + juce::String (Golden::getMaxDifferenceDecibels (render, reference), 1) + " dB");
+                else
+                    expectLessOrEqual (Golden::getMaxDifferenceDecibels (render, reference), floatTolerance, Golden::getReferenceName (c));
+            }
+        }
+
+        beginTest ("Double renders match the references");
+        {
+            for (const auto& c : cases)
+            {
+                const auto reference = readReference (getReferenceFile (options.references, c));
+
+                if (reference.getNumSamples() != Golden::getNumSamples (c.sampleRate))
+                    continue;   // already reported above
+
+                Golden::Renderer<double> renderer (c);
+                expectLessOrEqual (Golden::getMaxDifferenceDecibels (renderer.render (referenceBlockSize), reference),
+                                   doubleTolerance, Golden::getReferenceName (c));
+            }
+        }
+    }
+
+private:
+    template <typename SampleType>
+    void expectBlockSizeIndependent (const Golden::Case& c)
+    {
+        Golden::Renderer<SampleType> renderer (c);
+        const auto reference = renderer.render (referenceBlockSize);
+
+        for (auto blockSize : blockSizes)
+        {
+            const auto render = renderer.render (blockSize);
+
+            expect (isIdentical (render, reference),
+                    Golden::getReferenceName (c) + (std::is_same_v<SampleType, float> ? " (float)" : " (double)")
+                    + " at " + juce::String (blockSize) + " samples differs by "
+                    + juce::String (Golden::getMaxDifferenceDecibels (render, reference), 1) + " dB");
+        }
+    }
+};
+
+static EngineRegressionTest engineRegressionTest;
+
+//==============================================================================
+class ProcessorRegressionTest : public juce::UnitTest
+{
+public:
+    ProcessorRegressionTest() : juce::UnitTest ("Processor regression", "Regression") {}
+
+    void runTest() override
+    {
+        beginTest ("The processor renders the engine cases as the engine does");
+        {
+            for (const auto& c : Golden::getReferenceCases())
+            {
+                if (! Golden::canRenderThroughProcessor (c))
+                    continue;
+
+                // Not bit for bit, the values go through the parameters' normalised range first.
+                Golden::Renderer<float> engineRenderer (c);
+                Golden::ProcessorRenderer<float> processorRenderer (c);
+                expectLessOrEqual (Golden::getMaxDifferenceDecibels (processorRenderer.render (referenceBlockSize),
+                                                                     engineRenderer.render (referenceBlockSize)),
+                                   floatTolerance, Golden::getReferenceName (c));
+            }
+        }
+
+        beginTest ("Sessions come out the same at every host buffer size");
+        {
+            for (const auto& session : Golden::getSessions())
+            {
+                expectBlockSizeIndependent<float> (session);
+                expectBlockSizeIndependent<double> (session);
+            }
+        }
+
+        beginTest ("Offline renders through the processor are the same as realtime ones");
+        {
+            // The processor only splits blocks of 4096 samples or more, and the automation breaks
+            // the automated case into shorter ones, so this is down to the others.
+            for (const auto& c : Golden::getReferenceCases())
+            {
+                if (! Golden::canRenderThroughProcessor (c))
+                    continue;
+
+                Golden::ProcessorRenderer<float> renderer (c);
+                expect (isIdentical (renderer.render (10000), renderer.render (10000, true)), Golden::getReferenceName (c));
+            }
+        }
+
+        beginTest ("Session renders match the references");
+        {
+            for (const auto& session : Golden::getSessions())
+            {
+                const auto file = getReferenceFile (options.references, session);
+                const auto reference = readReference (file);
+                const auto isComplete = reference.getNumSamples() == Golden::getNumSamples (session.sampleRate);
+
+                expect (isComplete, "Missing or truncated reference " + file.getFullPathName());
+
+                if (! isComplete)
+                    continue;
+
+                Golden::ProcessorRenderer<float> floatRenderer (session);
+                const auto render = floatRenderer.render (referenceBlockSize);
+
+                if (options.exact)
+                    expect (isIdentical (render, reference), Golden::getReferenceName (session) + " differs by "
+                                                             + juce::String (Golden::getMaxDifferenceDecibels (render, reference), 1) + " dB");
+                else
+                    expectLessOrEqual (Golden::getMaxDifferenceDecibels (render, reference), floatTolerance, Golden::getReferenceName (session));
+
+                Golden::ProcessorRenderer<double> doubleRenderer (session);
+                expectLessOrEqual (Golden::getMaxDifferenceDecibels (doubleRenderer.render (referenceBlockSize), reference),
+                                   doubleTolerance, Golden::getReferenceName (session) + " (double)");
+            }
+        }
+    }
+
+private:
+    template <typename SampleType>
+    void expectBlockSizeIndependent (const Golden::Session& session)
+    {
+        Golden::ProcessorRenderer<SampleType> renderer (session);
+        const auto reference = renderer.render (referenceBlockSize);
+
+        for (auto blockSize : blockSizes)
+        {
+            const auto render = renderer.render (blockSize);
+
+            expect (isIdentical (render, reference),
+                    Golden::getReferenceName (session) + (std::is_same_v<SampleType, float> ? " (float)" : " (double)")
+                    + " at " + juce::String (blockSize) + " samples differs by "
+                    + juce::String (Golden::getMaxDifferenceDecibels (render, reference), 1) + " dB");
+        }
+    }
+};
+
+static ProcessorRegressionTest processorRegressionTest;
+}
@@ -0,0 +1,33 @@
+/*
+  ==============================================================================
+
+    RegressionTests.h
+    Created: 20 Oct 2026 12:41:06am
+    Author:  Myles Wang
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace RegressionTests
+{
+    struct Options
+    {
+        juce::File references;      // where the recorded renders live
+
+        // The float renders have to match the references bit for bit. Off by default, because a
+        // different compiler or instruction set may legitimately round differently.
+        bool exact { false };
+    };
+
+    // Read by the tests when they run.
+    void setOptions (const Options& newOptions);
+
+    // Renders every reference case with the float engine, and every session through the float
+    // processor, and writes them to `directory`, replacing
+    // what is there. Returns false if any file couldn't be written.
+    bool record (const juce::File& directory);
+}